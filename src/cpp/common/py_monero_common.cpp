@@ -51,6 +51,7 @@
  *
  * Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
  */
+#include "common/monero_error.h"
 #include "py_monero_common.h"
 
 // --------------------------- GEN UTILS ---------------------------
@@ -117,6 +118,162 @@ py::object PyGenUtils::ptree_to_pyobject(const boost::property_tree::ptree& tree
   }
 }
 
+std::string PyGenUtils::buffer_to_string(const py::buffer& buffer) {
+  Py_buffer view;
+  if (PyObject_GetBuffer(buffer.ptr(), &view, PyBUF_C_CONTIGUOUS) != 0) throw py::error_already_set();
+  try {
+    std::string result(static_cast<const char*>(view.buf), static_cast<size_t>(view.len));
+    PyBuffer_Release(&view);
+    return result;
+  } catch (...) {
+    PyBuffer_Release(&view);
+    throw;
+  }
+}
+
+size_t PyGenUtils::append_buffer_hex(std::string& hex, const py::handle& buffer) {
+  // the view pins the buffer, so it is encoded without the gil
+  Py_buffer view;
+  if (PyObject_GetBuffer(buffer.ptr(), &view, PyBUF_C_CONTIGUOUS) != 0) throw py::error_already_set();
+  size_t len = static_cast<size_t>(view.len);
+  try {
+    py::gil_scoped_release release;
+    append_hex(hex, static_cast<const char*>(view.buf), len);
+  } catch (...) {
+    PyBuffer_Release(&view);
+    throw;
+  }
+  PyBuffer_Release(&view);
+  return len;
+}
+
+void PyGenUtils::append_hex(std::string& hex, const char* data, size_t len) {
+  static const char digits[] = "0123456789abcdef";
+  size_t pos = hex.size();
+  hex.resize(pos + len * 2);
+  for (size_t i = 0; i < len; i++) {
+    uint8_t byte = static_cast<uint8_t>(data[i]);
+    hex[pos++] = digits[byte >> 4];
+    hex[pos++] = digits[byte & 0x0f];
+  }
+}
+
+std::string PyGenUtils::hex_to_binary(const char* hex, size_t len) {
+  if (len % 2 != 0) throw std::runtime_error("Invalid hex length");
+  auto nibble = [](char c) -> uint8_t {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    throw std::runtime_error("Invalid hex character");
+  };
+  std::string result(len / 2, '\0');
+  for (size_t i = 0; i < result.size(); i++) result[i] = static_cast<char>((nibble(hex[2 * i]) << 4) | nibble(hex[2 * i + 1]));
+  return result;
+}
+
+std::vector<std::string> PyGenUtils::sequence_to_strings(const py::handle& sequence) {
+  // list and tuple items are read in place, str and bytes are copied without going through a type caster
+  PyObject* seq = sequence.ptr();
+  if (!PyList_Check(seq) && !PyTuple_Check(seq)) throw py::type_error("Expected list or tuple");
+  Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+  PyObject** items = PySequence_Fast_ITEMS(seq);
+  std::vector<std::string> result;
+  result.reserve(static_cast<size_t>(size));
+  for (Py_ssize_t i = 0; i < size; i++) {
+    PyObject* item = items[i];
+    if (PyUnicode_Check(item)) {
+      Py_ssize_t len;
+      const char* data = PyUnicode_AsUTF8AndSize(item, &len);
+      if (data == nullptr) throw py::error_already_set();
+      result.emplace_back(data, static_cast<size_t>(len));
+    }
+    else if (PyBytes_Check(item)) result.emplace_back(PyBytes_AS_STRING(item), static_cast<size_t>(PyBytes_GET_SIZE(item)));
+    else result.emplace_back(py::handle(item).cast<std::string>());
+  }
+  return result;
+}
+
+std::vector<std::string> PyGenUtils::buffer_to_strings(const py::buffer& buffer) {
+  py::buffer_info info = buffer.request();
+  char kind = info.format.empty() ? '\0' : info.format.back();
+  if (info.ndim != 1 || (kind != 's' && kind != 'w')) throw py::type_error("Expected a one-dimensional array of bytes or str");
+
+  // items are padded with trailing nulls up to the item size, which are stripped like numpy does
+  std::vector<std::string> result;
+  result.reserve(static_cast<size_t>(info.shape[0]));
+  const char* data = static_cast<const char*>(info.ptr);
+  for (py::ssize_t i = 0; i < info.shape[0]; i++) {
+    const char* item = data + i * info.strides[0];
+    if (kind == 's') {
+      size_t len = static_cast<size_t>(info.itemsize);
+      while (len > 0 && item[len - 1] == '\0') len--;
+      result.emplace_back(item, len);
+      continue;
+    }
+
+    // unicode items are UCS4 code points
+    const Py_UCS4* chars = reinterpret_cast<const Py_UCS4*>(item);
+    Py_ssize_t len = static_cast<Py_ssize_t>(info.itemsize / sizeof(Py_UCS4));
+    while (len > 0 && chars[len - 1] == 0) len--;
+    py::object str = py::reinterpret_steal<py::object>(PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, chars, len));
+    if (!str) throw py::error_already_set();
+    Py_ssize_t utf8_len;
+    const char* utf8 = PyUnicode_AsUTF8AndSize(str.ptr(), &utf8_len);
+    if (utf8 == nullptr) throw py::error_already_set();
+    result.emplace_back(utf8, static_cast<size_t>(utf8_len));
+  }
+  return result;
+}
+
+std::vector<uint64_t> PyGenUtils::sequence_to_uint64s(const py::handle& sequence) {
+  PyObject* seq = sequence.ptr();
+  if (!PyList_Check(seq) && !PyTuple_Check(seq)) throw py::type_error("Expected list or tuple");
+  Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+  PyObject** items = PySequence_Fast_ITEMS(seq);
+  std::vector<uint64_t> result;
+  result.reserve(static_cast<size_t>(size));
+  for (Py_ssize_t i = 0; i < size; i++) {
+    PyObject* item = items[i];
+    if (PyLong_CheckExact(item)) {
+      unsigned long long value = PyLong_AsUnsignedLongLong(item);
+      if (value != static_cast<unsigned long long>(-1) || !PyErr_Occurred()) {
+        result.push_back(static_cast<uint64_t>(value));
+        continue;
+      }
+      PyErr_Clear();
+    }
+    // negative, oversized and non-int items get the type caster's error
+    result.push_back(py::handle(item).cast<uint64_t>());
+  }
+  return result;
+}
+
+// --------------------------- MONERO HASH32 ---------------------------
+
+monero_hash32 monero_hash32::from_hex(const std::string& hex) {
+  if (hex.size() != 64) throw std::runtime_error("Expected 64 hex characters");
+  std::string data = PyGenUtils::hex_to_binary(hex.data(), hex.size());
+  return from_bytes(data.data(), data.size());
+}
+
+monero_hash32 monero_hash32::from_bytes(const char* data, size_t len) {
+  monero_hash32 hash;
+  if (len != hash.m_data.size()) throw std::runtime_error("Expected 32 bytes");
+  std::memcpy(hash.m_data.data(), data, len);
+  return hash;
+}
+
+boost::optional<monero_hash32> monero_hash32::from_hex(const boost::optional<std::string>& hex) {
+  if (hex == boost::none) return boost::none;
+  return from_hex(hex.get());
+}
+
+std::string monero_hash32::to_hex() const {
+  std::string hex;
+  PyGenUtils::append_hex(hex, reinterpret_cast<const char*>(m_data.data()), m_data.size());
+  return hex;
+}
+
 // --------------------------- MONERO REQUEST PARAMS ---------------------------
 
 rapidjson::Value PyMoneroRequestParams::to_rapidjson_val(rapidjson::Document::AllocatorType& allocator) const {
@@ -131,3 +288,211 @@ rapidjson::Value PyMoneroRequestParams::to_rapidjson_val(rapidjson::Document::Al
 
   return root;
 }
+
+// --------------------------- THREAD POOL ---------------------------
+
+std::mutex PyMoneroThreadPool::s_instance_mutex;
+PyMoneroThreadPool* PyMoneroThreadPool::s_instance = nullptr;
+
+PyMoneroThreadPool& PyMoneroThreadPool::get_instance() {
+  std::lock_guard<std::mutex> lock(s_instance_mutex);
+  // never deleted so workers cannot outlive the pool during interpreter teardown
+  if (s_instance == nullptr) s_instance = new PyMoneroThreadPool(std::max<size_t>(2, std::thread::hardware_concurrency()));
+  return *s_instance;
+}
+
+void PyMoneroThreadPool::shutdown_instance() {
+  PyMoneroThreadPool* instance = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(s_instance_mutex);
+    instance = s_instance;
+  }
+  if (instance != nullptr) instance->shutdown();
+}
+
+PyMoneroThreadPool::PyMoneroThreadPool(size_t num_threads) {
+  for (size_t i = 0; i < num_threads; i++) {
+    m_threads.emplace_back([this]() { run(); });
+  }
+}
+
+void PyMoneroThreadPool::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopped) throw std::runtime_error("Thread pool is shut down");
+    m_tasks.push_back(std::move(task));
+  }
+  m_cv.notify_one();
+}
+
+void PyMoneroThreadPool::parallel_for(size_t num_workers, const std::function<void(size_t worker_idx)>& worker) {
+  if (num_workers == 0) return;
+
+  struct parallel_state {
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<bool> m_claimed;
+    size_t m_running = 0;
+    std::exception_ptr m_error;
+  };
+  auto state = std::make_shared<parallel_state>();
+  state->m_claimed.resize(num_workers, false);
+  state->m_claimed[0] = true;
+
+  auto run_worker = [state, &worker](size_t worker_idx) {
+    try {
+      worker(worker_idx);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state->m_mutex);
+      if (!state->m_error) state->m_error = std::current_exception();
+    }
+  };
+
+  // helper workers which have not started when the caller is done are skipped, so the
+  // caller never waits on a pool saturated by other callers
+  for (size_t i = 1; i < num_workers; i++) {
+    try {
+      submit([state, run_worker, i]() {
+        {
+          std::lock_guard<std::mutex> lock(state->m_mutex);
+          if (state->m_claimed[i]) return;
+          state->m_claimed[i] = true;
+          state->m_running++;
+        }
+        run_worker(i);
+        {
+          std::lock_guard<std::mutex> lock(state->m_mutex);
+          state->m_running--;
+        }
+        state->m_cv.notify_all();
+      });
+    } catch (...) {
+      break;
+    }
+  }
+
+  run_worker(0);
+
+  std::unique_lock<std::mutex> lock(state->m_mutex);
+  std::fill(state->m_claimed.begin(), state->m_claimed.end(), true);
+  state->m_cv.wait(lock, [&state]() { return state->m_running == 0; });
+  if (state->m_error) std::rethrow_exception(state->m_error);
+}
+
+void PyMoneroThreadPool::run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this]() { return m_stopped || !m_tasks.empty(); });
+      if (m_stopped) return;
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+    task();
+  }
+}
+
+void PyMoneroThreadPool::shutdown() {
+  std::deque<std::function<void()>> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopped) return;
+    m_stopped = true;
+    pending.swap(m_tasks);
+  }
+  m_cv.notify_all();
+  pending.clear();
+
+  // running tasks may need the GIL to complete
+  py::gil_scoped_release release;
+  for (auto& thread : m_threads) {
+    if (thread.joinable()) thread.join();
+  }
+}
+
+// --------------------------- ASYNC TASK ---------------------------
+
+std::shared_ptr<PyMoneroAsyncTask> PyMoneroAsyncTask::create(const std::function<void()>& on_cancel, const py::object& keep_alive) {
+  // python references are released with the GIL held, whichever thread drops the task last
+  std::shared_ptr<PyMoneroAsyncTask> task(new PyMoneroAsyncTask(), [](PyMoneroAsyncTask* t) {
+    py::gil_scoped_acquire gil;
+    // a task dropped without completing, e.g. still pending at pool shutdown, cancels its future
+    if (!t->m_completed) t->cancel();
+    delete t;
+  });
+  task->m_loop = py::module_::import("asyncio").attr("get_running_loop")();
+  task->m_future = task->m_loop.attr("create_future")();
+  task->m_keep_alive = keep_alive;
+  task->m_on_cancel = on_cancel;
+
+  std::weak_ptr<PyMoneroAsyncTask> weak_task = task;
+  task->m_future.attr("add_done_callback")(py::cpp_function([weak_task](const py::object& future) {
+    if (!future.attr("cancelled")().cast<bool>()) return;
+    auto task = weak_task.lock();
+    if (task == nullptr) return;
+    task->m_cancelled.store(true);
+    if (task->m_on_cancel) {
+      py::gil_scoped_release release;
+      try { task->m_on_cancel(); }
+      catch (...) { }
+    }
+  }));
+  return task;
+}
+
+void PyMoneroAsyncTask::set_result(const std::function<py::object()>& get_result) {
+  py::gil_scoped_acquire gil;
+  py::object value;
+  try {
+    value = get_result();
+  } catch (...) {
+    complete(to_py_exception(std::current_exception()), true);
+    return;
+  }
+  complete(value, false);
+}
+
+void PyMoneroAsyncTask::set_exception(std::exception_ptr error) {
+  py::gil_scoped_acquire gil;
+  complete(to_py_exception(error), true);
+}
+
+void PyMoneroAsyncTask::cancel() {
+  py::cpp_function callback([](const py::object& future) {
+    if (!future.attr("done")().cast<bool>()) future.attr("cancel")();
+  });
+  try {
+    m_loop.attr("call_soon_threadsafe")(callback, m_future);
+  } catch (py::error_already_set& e) {
+    // event loop is closed
+  }
+}
+
+void PyMoneroAsyncTask::complete(const py::object& value, bool is_error) {
+  m_completed = true;
+  py::cpp_function callback([](const py::object& future, const py::object& value, bool is_error) {
+    if (future.attr("done")().cast<bool>()) return;
+    future.attr(is_error ? "set_exception" : "set_result")(value);
+  });
+  try {
+    m_loop.attr("call_soon_threadsafe")(callback, m_future, value, is_error);
+  } catch (py::error_already_set& e) {
+    // event loop is closed
+  }
+}
+
+py::object PyMoneroAsyncTask::to_py_exception(std::exception_ptr error) {
+  py::module_ monero = py::module_::import("monero");
+  try {
+    std::rethrow_exception(error);
+  } catch (py::error_already_set& e) {
+    return e.value();
+  } catch (const monero_rpc_error& e) {
+    return monero.attr("MoneroRpcError")(e.what(), e.code);
+  } catch (const std::exception& e) {
+    return monero.attr("MoneroError")(e.what());
+  } catch (...) {
+    return monero.attr("MoneroError")("Unknown error");
+  }
+}
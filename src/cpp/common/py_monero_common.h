@@ -56,6 +56,19 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <boost/optional.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
 
 #include "common/monero_rpc_connection.h"
 #include "daemon/monero_daemon_model.h"
@@ -113,8 +126,130 @@ public:
   static py::dict deserialize(const std::string& s);
   static py::object convert_value(const std::string& val);
   static py::object ptree_to_pyobject(const boost::property_tree::ptree& tree);
+  static std::string buffer_to_string(const py::buffer& buffer);
+  /**
+   * Append the hex encoding of a buffer, returning the number of bytes encoded.
+   *
+   * Must be called with the GIL held, which is released while encoding.
+   */
+  static size_t append_buffer_hex(std::string& hex, const py::handle& buffer);
+  static void append_hex(std::string& hex, const char* data, size_t len);
+  static std::string hex_to_binary(const char* hex, size_t len);
+  static std::vector<std::string> sequence_to_strings(const py::handle& sequence);
+  /**
+   * Convert a one-dimensional array of fixed-width bytes or unicode items, e.g. a numpy 'S' or 'U' array.
+   */
+  static std::vector<std::string> buffer_to_strings(const py::buffer& buffer);
+  static std::vector<uint64_t> sequence_to_uint64s(const py::handle& sequence);
+
+  /**
+   * Serialize structs to one json array, built one element at a time.
+   */
+  template<class T>
+  static std::string serialize_many(const std::vector<std::shared_ptr<T>>& structs) {
+    return serialize_many(structs, [](const T& s, rapidjson::Document::AllocatorType& allocator) { return s.to_rapidjson_val(allocator); });
+  }
+
+  /**
+   * Serialize structs to one json array, each element converted by to_val(struct, allocator).
+   */
+  template<class T, class F>
+  static std::string serialize_many(const std::vector<std::shared_ptr<T>>& structs, F&& to_val) {
+    rapidjson::StringBuffer buffer(nullptr, std::max<size_t>(256, structs.size() * 256));
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    rapidjson::Document::AllocatorType allocator;
+    writer.StartArray();
+    for (const auto& s : structs) {
+      if (s == nullptr) writer.Null();
+      else to_val(*s, allocator).Accept(writer);
+      allocator.Clear();
+    }
+    writer.EndArray();
+    return std::string(buffer.GetString(), buffer.GetSize());
+  }
+
+  /**
+   * Copy a one-dimensional buffer of integers into a vector without boxing its elements.
+   */
+  template<class T>
+  static std::vector<T> buffer_to_vector(const py::buffer& buffer) {
+    py::buffer_info info = buffer.request();
+    if (info.ndim != 1) throw std::runtime_error("Expected a 1-dimensional buffer");
+    std::string format = info.format;
+    if (!format.empty() && (format[0] == '@' || format[0] == '=')) format.erase(0, 1);
+    if (format.size() != 1) throw std::runtime_error("Unsupported buffer format: " + info.format);
+    bool is_signed;
+    if (std::string("bhilqn").find(format[0]) != std::string::npos) is_signed = true;
+    else if (std::string("?BHILQN").find(format[0]) != std::string::npos) is_signed = false;
+    else throw std::runtime_error("Expected a buffer of integers, got format: " + info.format);
+
+    std::vector<T> result(static_cast<size_t>(info.shape[0]));
+    const char* data = static_cast<const char*>(info.ptr);
+    py::ssize_t stride = info.strides[0];
+    py::gil_scoped_release release;
+    switch (info.itemsize) {
+      case 1: is_signed ? copy_buffer<T, int8_t>(result, data, stride) : copy_buffer<T, uint8_t>(result, data, stride); break;
+      case 2: is_signed ? copy_buffer<T, int16_t>(result, data, stride) : copy_buffer<T, uint16_t>(result, data, stride); break;
+      case 4: is_signed ? copy_buffer<T, int32_t>(result, data, stride) : copy_buffer<T, uint32_t>(result, data, stride); break;
+      case 8: is_signed ? copy_buffer<T, int64_t>(result, data, stride) : copy_buffer<T, uint64_t>(result, data, stride); break;
+      default: throw std::runtime_error("Unsupported buffer item size: " + std::to_string(info.itemsize));
+    }
+    return result;
+  }
+
+private:
+  template<class T, class S>
+  static void copy_buffer(std::vector<T>& result, const char* data, py::ssize_t stride) {
+    if (std::is_same<T, S>::value && stride == static_cast<py::ssize_t>(sizeof(T))) {
+      if (!result.empty()) std::memcpy(result.data(), data, result.size() * sizeof(T));
+      return;
+    }
+    for (size_t i = 0; i < result.size(); i++) {
+      S value;
+      std::memcpy(&value, data + static_cast<py::ssize_t>(i) * stride, sizeof(S));
+      if (!is_in_range<T>(value)) throw std::runtime_error("Buffer value at index " + std::to_string(i) + " is out of range");
+      result[i] = static_cast<T>(value);
+    }
+  }
+
+  template<class T, class S>
+  static bool is_in_range(S value) {
+    if constexpr (std::is_signed<S>::value) {
+      if (value < 0) return std::is_signed<T>::value && static_cast<int64_t>(value) >= static_cast<int64_t>(std::numeric_limits<T>::min());
+    }
+    return static_cast<uint64_t>(value) <= static_cast<uint64_t>(std::numeric_limits<T>::max());
+  }
 };
 
+/**
+ * Fixed-size 32-byte hash or key, converted from and to hex only at the edges.
+ */
+struct monero_hash32 {
+public:
+  std::array<uint8_t, 32> m_data{};
+
+  static monero_hash32 from_hex(const std::string& hex);
+  static monero_hash32 from_bytes(const char* data, size_t len);
+  static boost::optional<monero_hash32> from_hex(const boost::optional<std::string>& hex);
+  std::string to_hex() const;
+
+  bool operator==(const monero_hash32& other) const { return m_data == other.m_data; }
+  bool operator!=(const monero_hash32& other) const { return m_data != other.m_data; }
+  bool operator<(const monero_hash32& other) const { return m_data < other.m_data; }
+};
+
+namespace std {
+  template<>
+  struct hash<monero_hash32> {
+    size_t operator()(const monero_hash32& hash) const {
+      // hashes and keys are uniformly distributed, so any of their bytes make a good hash
+      size_t result;
+      std::memcpy(&result, hash.m_data.data(), sizeof(result));
+      return result;
+    }
+  };
+}
+
 struct PyMoneroRequestParams : public monero_request_params {
 public:
   boost::optional<py::object> m_py_params;
@@ -124,3 +259,87 @@ public:
 
   rapidjson::Value to_rapidjson_val(rapidjson::Document::AllocatorType& allocator) const override;
 };
+
+/**
+ * Library-owned pool of worker threads.
+ */
+class PyMoneroThreadPool {
+public:
+  static PyMoneroThreadPool& get_instance();
+  static void shutdown_instance();
+
+  size_t get_num_threads() const { return m_threads.size(); }
+  void submit(std::function<void()> task);
+  void parallel_for(size_t num_workers, const std::function<void(size_t worker_idx)>& worker);
+  void shutdown();
+
+private:
+  explicit PyMoneroThreadPool(size_t num_threads);
+  void run();
+
+  static std::mutex s_instance_mutex;
+  static PyMoneroThreadPool* s_instance;
+
+  std::vector<std::thread> m_threads;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stopped = false;
+};
+
+/**
+ * Asyncio future completed from a worker thread.
+ */
+class PyMoneroAsyncTask {
+public:
+  static std::shared_ptr<PyMoneroAsyncTask> create(const std::function<void()>& on_cancel, const py::object& keep_alive);
+
+  const py::object& get_future() const { return m_future; }
+  bool is_cancelled() const { return m_cancelled.load(); }
+  void set_result(const std::function<py::object()>& get_result);
+  void set_exception(std::exception_ptr error);
+
+private:
+  PyMoneroAsyncTask() { }
+  void complete(const py::object& value, bool is_error);
+  void cancel();
+  static py::object to_py_exception(std::exception_ptr error);
+
+  py::object m_loop;
+  py::object m_future;
+  py::object m_keep_alive;
+  std::function<void()> m_on_cancel;
+  std::atomic<bool> m_cancelled{false};
+  bool m_completed = false;
+};
+
+class PyMoneroAsync {
+public:
+  /**
+   * Run a task on the thread pool and return an asyncio future of its result.
+   *
+   * Must be called with the GIL held from a running event loop. A task cancelled
+   * before it starts is skipped, otherwise on_cancel is invoked to interrupt it.
+   * Tasks still pending when the pool shuts down cancel their futures.
+   */
+  template <typename F>
+  static py::object run(F&& task, const std::function<void()>& on_cancel = nullptr, const py::object& keep_alive = py::none()) {
+    using R = decltype(task());
+    auto async_task = PyMoneroAsyncTask::create(on_cancel, keep_alive);
+    PyMoneroThreadPool::get_instance().submit([async_task, task = std::forward<F>(task)]() mutable {
+      if (async_task->is_cancelled()) return;
+      try {
+        if constexpr (std::is_void<R>::value) {
+          task();
+          async_task->set_result([]() { return py::object(py::none()); });
+        } else {
+          auto result = std::make_shared<R>(task());
+          async_task->set_result([result]() { return py::cast(std::move(*result)); });
+        }
+      } catch (...) {
+        async_task->set_exception(std::current_exception());
+      }
+    });
+    return async_task->get_future();
+  }
+};
@@ -55,23 +55,50 @@
 
 void py_monero_bind_vectors_and_maps(py::module_& m) {
 
-  py::bind_vector<VectorInt>(m, "VectorInt")
+  py::bind_vector<VectorInt>(m, "VectorInt", py::buffer_protocol())
+    .def(py::init([](const py::buffer& buffer) {
+      MONERO_CATCH_AND_RETHROW(PyGenUtils::buffer_to_vector<int>(buffer));
+    }), py::arg("buffer"), py::prepend())
     .def("copy", [](const VectorInt& v) {
         return VectorInt(v);
     });
-  py::bind_vector<VectorUint8>(m, "VectorUint8")
+  py::bind_vector<VectorUint8>(m, "VectorUint8", py::buffer_protocol())
+    .def(py::init([](const py::buffer& buffer) {
+      MONERO_CATCH_AND_RETHROW(PyGenUtils::buffer_to_vector<uint8_t>(buffer));
+    }), py::arg("buffer"), py::prepend())
     .def("copy", [](const VectorUint8& v) {
         return VectorUint8(v);
     });
-  py::bind_vector<VectorUint32>(m, "VectorUint32")
+  py::bind_vector<VectorUint32>(m, "VectorUint32", py::buffer_protocol())
+    .def(py::init([](const py::buffer& buffer) {
+      MONERO_CATCH_AND_RETHROW(PyGenUtils::buffer_to_vector<uint32_t>(buffer));
+    }), py::arg("buffer"), py::prepend())
     .def("copy", [](const VectorUint32& v) {
         return VectorUint32(v);
     });
-  py::bind_vector<VectorUint64>(m, "VectorUint64")
+  py::bind_vector<VectorUint64>(m, "VectorUint64", py::buffer_protocol())
+    .def(py::init([](const py::buffer& buffer) {
+      MONERO_CATCH_AND_RETHROW(PyGenUtils::buffer_to_vector<uint64_t>(buffer));
+    }), py::arg("buffer"), py::prepend())
+    .def(py::init([](const py::tuple& items) {
+      return PyGenUtils::sequence_to_uint64s(items);
+    }), py::arg("items"), py::prepend())
+    .def(py::init([](const py::list& items) {
+      return PyGenUtils::sequence_to_uint64s(items);
+    }), py::arg("items"), py::prepend())
     .def("copy", [](const VectorUint64& v) {
         return VectorUint64(v);
     });
   py::bind_vector<VectorString>(m, "VectorString")
+    .def(py::init([](const py::tuple& items) {
+      return PyGenUtils::sequence_to_strings(items);
+    }), py::arg("items"), py::prepend())
+    .def(py::init([](const py::list& items) {
+      return PyGenUtils::sequence_to_strings(items);
+    }), py::arg("items"), py::prepend())
+    .def(py::init([](const py::buffer& items) {
+      return PyGenUtils::buffer_to_strings(items);
+    }), py::arg("items"), py::prepend())
     .def("copy", [](const VectorString& v) {
         return VectorString(v);
     });
@@ -84,10 +111,56 @@ void py_monero_bind_vectors_and_maps(py::module_& m) {
         return std::vector<std::shared_ptr<monero_key_image>>(v);
     });
   py::bind_vector<std::vector<std::shared_ptr<monero_block>>>(m, "VectorMoneroBlock")
+    .def(py::pickle([](const std::vector<std::shared_ptr<monero_block>>& v) {
+        MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph(std::vector<std::shared_ptr<serializable_struct>>(v.begin(), v.end()))));
+    }, [](const py::bytes& state) {
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_objects<monero_block>(state));
+    }))
+    .def_static("deserialize_many", [](const py::buffer& data, bool use_arena) {
+        std::string json = PyGenUtils::buffer_to_string(data);
+        py::gil_scoped_release release;
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_blocks(json, use_arena));
+    }, py::arg("data"), py::arg("use_arena") = false)
+    .def("serialize_many", [](const std::vector<std::shared_ptr<monero_block>>& v) {
+        std::string json;
+        {
+          py::gil_scoped_release release;
+          json = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(PyGenUtils::serialize_many(v)); }();
+        }
+        return py::bytes(json);
+    })
+    .def("sort_by", [](std::vector<std::shared_ptr<monero_block>>& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("column", [](const std::vector<std::shared_ptr<monero_block>>& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const std::vector<std::shared_ptr<monero_block>>& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_block>();
+    })
     .def("copy", [](const std::vector<std::shared_ptr<monero_block>>& v) {
         return std::vector<std::shared_ptr<monero_block>>(v);
     });
   py::bind_vector<std::vector<std::shared_ptr<monero_block_header>>>(m, "VectorMoneroBlockHeader")
+    .def("sort_by", [](std::vector<std::shared_ptr<monero_block_header>>& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("column", [](const std::vector<std::shared_ptr<monero_block_header>>& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const std::vector<std::shared_ptr<monero_block_header>>& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_block_header>();
+    })
     .def("copy", [](const std::vector<std::shared_ptr<monero_block_header>>& v) {
         return std::vector<std::shared_ptr<monero_block_header>>(v);
     });
@@ -95,25 +168,161 @@ void py_monero_bind_vectors_and_maps(py::module_& m) {
     .def("sort", [](VectorMoneroTx &v) {
         std::sort(v.begin(), v.end(), monero_tx_height_comparator());
     })
+    .def("sort_by", [](VectorMoneroTx& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("column", [](const VectorMoneroTx& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const VectorMoneroTx& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_tx>();
+    })
     .def("copy", [](const VectorMoneroTx& v) {
         return VectorMoneroTx(v);
     });
   py::bind_vector<VectorMoneroTxWallet>(m, "VectorMoneroTxWallet")
+    .def(py::pickle([](const VectorMoneroTxWallet& v) {
+        MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph(std::vector<std::shared_ptr<serializable_struct>>(v.begin(), v.end()))));
+    }, [](const py::bytes& state) {
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_objects<monero_tx_wallet>(state));
+    }))
+    .def_static("deserialize_many", [](const py::buffer& data, bool use_arena) {
+        std::string json = PyGenUtils::buffer_to_string(data);
+        py::gil_scoped_release release;
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_txs(json, use_arena));
+    }, py::arg("data"), py::arg("use_arena") = false)
+    .def("serialize_many", [](const VectorMoneroTxWallet& v) {
+        std::string json;
+        {
+          py::gil_scoped_release release;
+          json = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::serialize_txs(v)); }();
+        }
+        return py::bytes(json);
+    })
     .def("sort", [](VectorMoneroTxWallet &v) {
         std::sort(v.begin(), v.end(), monero_tx_height_comparator());
     })
+    .def("sort_by", [](VectorMoneroTxWallet& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("filter", [](const VectorMoneroTxWallet& v, const monero_tx_query& query) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::filter(v, query));
+    }, py::arg("query"))
+    .def("column", [](const VectorMoneroTxWallet& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const VectorMoneroTxWallet& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_tx_wallet>();
+    })
     .def("copy", [](const VectorMoneroTxWallet& v) {
         return VectorMoneroTxWallet(v);
     });
   py::bind_vector<std::vector<std::shared_ptr<monero_output>>>(m, "VectorMoneroOutput")
+    .def("sort_by", [](std::vector<std::shared_ptr<monero_output>>& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("column", [](const std::vector<std::shared_ptr<monero_output>>& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const std::vector<std::shared_ptr<monero_output>>& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_output>();
+    })
     .def("copy", [](const std::vector<std::shared_ptr<monero_output>>& v) {
         return std::vector<std::shared_ptr<monero_output>>(v);
     });
   py::bind_vector<std::vector<std::shared_ptr<monero_output_wallet>>>(m, "VectorMoneroOutputWallet")
+    .def(py::pickle([](const std::vector<std::shared_ptr<monero_output_wallet>>& v) {
+        MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph(std::vector<std::shared_ptr<serializable_struct>>(v.begin(), v.end()))));
+    }, [](const py::bytes& state) {
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_objects<monero_output_wallet>(state));
+    }))
+    .def_static("deserialize_many", [](const py::buffer& data, bool use_arena) {
+        std::string json = PyGenUtils::buffer_to_string(data);
+        py::gil_scoped_release release;
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_outputs(json, use_arena));
+    }, py::arg("data"), py::arg("use_arena") = false)
+    .def("serialize_many", [](const std::vector<std::shared_ptr<monero_output_wallet>>& v) {
+        std::string json;
+        {
+          py::gil_scoped_release release;
+          json = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(PyGenUtils::serialize_many(v)); }();
+        }
+        return py::bytes(json);
+    })
+    .def("sort_by", [](std::vector<std::shared_ptr<monero_output_wallet>>& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("filter", [](const std::vector<std::shared_ptr<monero_output_wallet>>& v, const monero_output_query& query) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::filter(v, query));
+    }, py::arg("query"))
+    .def("column", [](const std::vector<std::shared_ptr<monero_output_wallet>>& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const std::vector<std::shared_ptr<monero_output_wallet>>& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_output_wallet>();
+    })
     .def("copy", [](const std::vector<std::shared_ptr<monero_output_wallet>>& v) {
         return std::vector<std::shared_ptr<monero_output_wallet>>(v);
     });
   py::bind_vector<std::vector<std::shared_ptr<monero_transfer>>>(m, "VectorMoneroTransfer")
+    .def(py::pickle([](const std::vector<std::shared_ptr<monero_transfer>>& v) {
+        MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph(std::vector<std::shared_ptr<serializable_struct>>(v.begin(), v.end()))));
+    }, [](const py::bytes& state) {
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_objects<monero_transfer>(state));
+    }))
+    .def_static("deserialize_many", [](const py::buffer& data, bool use_arena) {
+        std::string json = PyGenUtils::buffer_to_string(data);
+        py::gil_scoped_release release;
+        MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_transfers(json, use_arena));
+    }, py::arg("data"), py::arg("use_arena") = false)
+    .def("serialize_many", [](const std::vector<std::shared_ptr<monero_transfer>>& v) {
+        std::string json;
+        {
+          py::gil_scoped_release release;
+          json = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::serialize_transfers(v)); }();
+        }
+        return py::bytes(json);
+    })
+    .def("sort_by", [](std::vector<std::shared_ptr<monero_transfer>>& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("filter", [](const std::vector<std::shared_ptr<monero_transfer>>& v, const monero_transfer_query& query) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::filter(v, query));
+    }, py::arg("query"))
+    .def("column", [](const std::vector<std::shared_ptr<monero_transfer>>& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const std::vector<std::shared_ptr<monero_transfer>>& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_transfer>();
+    })
     .def("copy", [](const std::vector<std::shared_ptr<monero_transfer>>& v) {
         return std::vector<std::shared_ptr<monero_transfer>>(v);
     });
@@ -121,10 +330,46 @@ void py_monero_bind_vectors_and_maps(py::module_& m) {
     .def("sort", [](VectorMoneroIncomingTransfer &v) {
         std::sort(v.begin(), v.end(), monero_incoming_transfer_comparator());
     })
+    .def("sort_by", [](VectorMoneroIncomingTransfer& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("filter", [](const VectorMoneroIncomingTransfer& v, const monero_transfer_query& query) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::filter(v, query));
+    }, py::arg("query"))
+    .def("column", [](const VectorMoneroIncomingTransfer& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const VectorMoneroIncomingTransfer& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_incoming_transfer>();
+    })
     .def("copy", [](const VectorMoneroIncomingTransfer& v) {
         return VectorMoneroIncomingTransfer(v);
     });
   py::bind_vector<VectorMoneroOutgoingTransfer>(m, "VectorMoneroOutgoingTransfer")
+    .def("sort_by", [](VectorMoneroOutgoingTransfer& v, const std::vector<std::string>& keys, uint32_t num_threads) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sort_by(v, keys, num_threads));
+    }, py::arg("keys"), py::arg("num_threads") = 0)
+    .def("filter", [](const VectorMoneroOutgoingTransfer& v, const monero_transfer_query& query) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::filter(v, query));
+    }, py::arg("query"))
+    .def("column", [](const VectorMoneroOutgoingTransfer& v, const std::string& name) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_column(v, name));
+    }, py::arg("name"))
+    .def("column_uint64", [](const VectorMoneroOutgoingTransfer& v, const std::string& name, uint64_t fill) {
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_uint64_column(v, name, fill));
+    }, py::arg("name"), py::arg("fill") = 0)
+    .def_static("column_names", []() {
+      return PyMoneroWalletUtils::get_column_names<monero_outgoing_transfer>();
+    })
     .def("copy", [](const VectorMoneroOutgoingTransfer& v) {
         return VectorMoneroOutgoingTransfer(v);
     });
@@ -225,12 +470,55 @@ void py_monero_bind_errors_and_enums(py::module_& m) {
 }
 
 void py_monero_bind_common(py::module_& m, PyMoneroTypes& t) {
+  // join worker threads before the interpreter finalizes
+  py::module_::import("atexit").attr("register")(py::cpp_function([]() {
+    PyMoneroThreadPool::shutdown_instance();
+  }));
+
   // serializable_struct
   t.py_serializable_struct
     .def("serialize", [](serializable_struct& self) {
       MONERO_CATCH_AND_RETHROW(self.serialize());
     });
 
+  // monero_hash32
+  t.py_monero_hash32
+    .def(py::init<>())
+    .def(py::init([](const std::string& hex) {
+      MONERO_CATCH_AND_RETHROW(monero_hash32::from_hex(hex));
+    }), py::arg("hex"))
+    .def_static("from_bytes", [](const py::buffer& data) {
+      std::string bytes = PyGenUtils::buffer_to_string(data);
+      MONERO_CATCH_AND_RETHROW(monero_hash32::from_bytes(bytes.data(), bytes.size()));
+    }, py::arg("data"))
+    .def_buffer([](monero_hash32& self) {
+      return py::buffer_info(self.m_data.data(), 1, py::format_descriptor<uint8_t>::format(), 1, { static_cast<py::ssize_t>(self.m_data.size()) }, { 1 }, true);
+    })
+    .def("hex", [](const monero_hash32& self) {
+      return self.to_hex();
+    })
+    .def("__bytes__", [](const monero_hash32& self) {
+      return py::bytes(reinterpret_cast<const char*>(self.m_data.data()), self.m_data.size());
+    })
+    .def("__str__", [](const monero_hash32& self) {
+      return self.to_hex();
+    })
+    .def("__repr__", [](const monero_hash32& self) {
+      return "MoneroHash32('" + self.to_hex() + "')";
+    })
+    .def("__eq__", [](const monero_hash32& self, const monero_hash32& other) {
+      return self == other;
+    }, py::is_operator())
+    .def("__ne__", [](const monero_hash32& self, const monero_hash32& other) {
+      return self != other;
+    }, py::is_operator())
+    .def("__lt__", [](const monero_hash32& self, const monero_hash32& other) {
+      return self < other;
+    }, py::is_operator())
+    .def("__hash__", [](const monero_hash32& self) {
+      return std::hash<monero_hash32>()(self);
+    });
+
   // monero_rpc_payment_info
   t.py_monero_rpc_payment_info
     .def(py::init<>())
@@ -95,6 +95,9 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
     .def_readwrite("prev_hash", &monero_block_header::m_prev_hash)
     .def_readwrite("reward", &monero_block_header::m_reward)
     .def_readwrite("pow_hash", &monero_block_header::m_pow_hash)
+    .def("get_hash32", [](const monero_block_header& self) {
+      MONERO_CATCH_AND_RETHROW(monero_hash32::from_hex(self.m_hash));
+    })
     .def("copy", [](const std::shared_ptr<monero_block_header>& self) {
       auto tgt = std::make_shared<monero_block_header>();
       MONERO_CATCH_AND_RETHROW(self->copy(self, tgt));
@@ -106,6 +109,11 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
   // monero_block (needs: monero_tx)
   t.py_monero_block
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_block>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_block>(state));
+    }))
     .def("__str__", &monero_block::serialize)
     .def_readwrite("hex", &monero_block::m_hex)
     .def_readwrite("miner_tx", &monero_block::m_miner_tx)
@@ -349,6 +357,11 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
   // monero_tx
   t.py_monero_tx
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_tx>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_tx>(state));
+    }))
     .def_property_readonly_static("DEFAULT_PAYMENT_ID", [](py::object /* self */) { return monero_tx::DEFAULT_PAYMENT_ID; })
     .def_readwrite("block", &monero_tx::m_block)
     .def_readwrite("hash", &monero_tx::m_hash)
@@ -398,6 +411,9 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
     .def("get_height", [](monero_tx& self) {
       MONERO_CATCH_AND_RETHROW(self.get_height());
     })
+    .def("get_hash32", [](const monero_tx& self) {
+      MONERO_CATCH_AND_RETHROW(monero_hash32::from_hex(self.m_hash));
+    })
     .def("__lt__", [](const std::shared_ptr<monero_tx>& a, const std::shared_ptr<monero_tx>& b){
       monero_tx_height_comparator comp;
       return comp(a, b);
@@ -410,6 +426,9 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
       MONERO_CATCH_AND_RETHROW(monero_key_image::deserialize_key_images(key_images_json));
     }, py::arg("key_images_json"))
     .def_readwrite("hex", &monero_key_image::m_hex)
+    .def("get_hex32", [](const monero_key_image& self) {
+      MONERO_CATCH_AND_RETHROW(monero_hash32::from_hex(self.m_hex));
+    })
     .def_readwrite("signature", &monero_key_image::m_signature)
     .def("copy", [](const std::shared_ptr<monero_key_image>& self) {
       auto tgt = std::make_shared<monero_key_image>();
@@ -422,6 +441,11 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
   // monero_output
   t.py_monero_output
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_output>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_output>(state));
+    }))
     .def_readwrite("tx", &monero_output::m_tx)
     .def_readwrite("key_image", &monero_output::m_key_image)
     .def_readwrite("amount", &monero_output::m_amount)
@@ -653,7 +677,37 @@ void py_monero_bind_daemon(py::module_& m, PyMoneroTypes& t) {
     }, py::call_guard<py::gil_scoped_release>())
     .def("wait_for_next_block_header", [](monero_daemon& self) {
       MONERO_CATCH_AND_RETHROW(self.wait_for_next_block_header());
-    }, py::call_guard<py::gil_scoped_release>());
+    }, py::call_guard<py::gil_scoped_release>())
+    .def("get_height_async", [](const std::shared_ptr<monero_daemon>& self) {
+      return PyMoneroAsync::run([self]() {
+        return self->get_height();
+      });
+    })
+    .def("get_info_async", [](const std::shared_ptr<monero_daemon>& self) {
+      return PyMoneroAsync::run([self]() {
+        return self->get_info();
+      });
+    })
+    .def("get_block_by_height_async", [](const std::shared_ptr<monero_daemon>& self, uint64_t height) {
+      return PyMoneroAsync::run([self, height]() {
+        return self->get_block_by_height(height);
+      });
+    }, py::arg("height"))
+    .def("get_block_by_hash_async", [](const std::shared_ptr<monero_daemon>& self, const std::string& hash) {
+      return PyMoneroAsync::run([self, hash]() {
+        return self->get_block_by_hash(hash);
+      });
+    }, py::arg("hash"))
+    .def("get_txs_async", [](const std::shared_ptr<monero_daemon>& self, const std::vector<std::string>& tx_hashes, bool prune) {
+      return PyMoneroAsync::run([self, tx_hashes, prune]() {
+        return self->get_txs(tx_hashes, prune);
+      });
+    }, py::arg("tx_hashes"), py::arg("prune") = false)
+    .def("wait_for_next_block_header_async", [](const std::shared_ptr<monero_daemon>& self) {
+      return PyMoneroAsync::run([self]() {
+        return self->wait_for_next_block_header();
+      });
+    });
 
   // monero_daemon_rpc
   t.py_monero_daemon_rpc
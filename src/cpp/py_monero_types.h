@@ -141,6 +141,15 @@ struct PyMoneroTypes {
   py::class_<monero_multisig_sign_result, serializable_struct, std::shared_ptr<monero_multisig_sign_result>> py_monero_multisig_sign_result;
   py::class_<monero_address_book_entry, serializable_struct, std::shared_ptr<monero_address_book_entry>> py_monero_address_book_entry;
   py::class_<monero_wallet_listener, PyMoneroWalletListener, std::shared_ptr<monero_wallet_listener>> py_monero_wallet_listener;
+  py::class_<monero_partition_scan_listener, PyMoneroPartitionScanListener, std::shared_ptr<monero_partition_scan_listener>> py_monero_partition_scan_listener;
+  py::class_<monero_partition_scan_result, std::shared_ptr<monero_partition_scan_result>> py_monero_partition_scan_result;
+  py::class_<monero_output_columns, std::shared_ptr<monero_output_columns>> py_monero_output_columns;
+  py::class_<monero_tx_batch_result, std::shared_ptr<monero_tx_batch_result>> py_monero_tx_batch_result;
+  py::class_<monero_tx_set_batch_result, std::shared_ptr<monero_tx_set_batch_result>> py_monero_tx_set_batch_result;
+  py::class_<monero_check_batch_result, std::shared_ptr<monero_check_batch_result>> py_monero_check_batch_result;
+  py::class_<monero_message_batch_result, std::shared_ptr<monero_message_batch_result>> py_monero_message_batch_result;
+  py::class_<monero_balance_index, std::shared_ptr<monero_balance_index>> py_monero_balance_index;
+  py::class_<monero_subaddress_lookup, std::shared_ptr<monero_subaddress_lookup>> py_monero_subaddress_lookup;
   py::class_<monero_daemon_listener, PyMoneroDaemonListener, std::shared_ptr<monero_daemon_listener>> py_monero_daemon_listener;
   py::class_<monero_daemon, std::shared_ptr<monero_daemon>> py_monero_daemon;
   py::class_<monero_daemon_rpc, monero_daemon, std::shared_ptr<monero_daemon_rpc>> py_monero_daemon_rpc;
@@ -153,6 +162,7 @@ struct PyMoneroTypes {
   py::class_<monero_tx_height_comparator, std::shared_ptr<monero_tx_height_comparator>> py_tx_height_comparator;
   py::class_<monero_incoming_transfer_comparator, std::shared_ptr<monero_incoming_transfer_comparator>> py_incoming_transfer_comparator;
   py::class_<monero_output_comparator, std::shared_ptr<monero_output_comparator>> py_output_comparator;
+  py::class_<monero_hash32, std::shared_ptr<monero_hash32>> py_monero_hash32;
 
   explicit PyMoneroTypes(py::module_& m) :
     py_serializable_struct(m, "SerializableStruct"),
@@ -194,6 +204,15 @@ struct PyMoneroTypes {
     py_monero_multisig_sign_result(m, "MoneroMultisigSignResult"),
     py_monero_address_book_entry(m, "MoneroAddressBookEntry"),
     py_monero_wallet_listener(m, "MoneroWalletListener"),
+    py_monero_partition_scan_listener(m, "MoneroPartitionScanListener"),
+    py_monero_partition_scan_result(m, "MoneroPartitionScanResult"),
+    py_monero_output_columns(m, "MoneroOutputColumns"),
+    py_monero_tx_batch_result(m, "MoneroTxBatchResult"),
+    py_monero_tx_set_batch_result(m, "MoneroTxSetBatchResult"),
+    py_monero_check_batch_result(m, "MoneroCheckBatchResult"),
+    py_monero_message_batch_result(m, "MoneroMessageBatchResult"),
+    py_monero_balance_index(m, "MoneroBalanceIndex"),
+    py_monero_subaddress_lookup(m, "MoneroSubaddressLookup"),
     py_monero_daemon_listener(m, "MoneroDaemonListener"),
     py_monero_daemon(m, "MoneroDaemon"),
     py_monero_daemon_rpc(m, "MoneroDaemonRpc"),
@@ -204,7 +223,8 @@ struct PyMoneroTypes {
     py_monero_utils(m, "MoneroUtils"),
     py_tx_height_comparator(m, "TxHeightComparator"),
     py_incoming_transfer_comparator(m, "IncomingTransferComparator"),
-    py_output_comparator(m, "OutputComparator")
+    py_output_comparator(m, "OutputComparator"),
+    py_monero_hash32(m, "MoneroHash32", py::buffer_protocol())
   {}
 };
 
@@ -52,6 +52,8 @@
  * Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
  */
 #include <regex>
+#include <algorithm>
+#include <unordered_map>
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "py_monero_utils.h"
 
@@ -116,6 +118,32 @@ std::vector<std::shared_ptr<monero_tx_wallet>> PyMoneroUtils::get_and_sort_txs(c
   return txs;
 }
 
+std::vector<std::shared_ptr<monero_tx_wallet>> PyMoneroUtils::merge_txs(const std::vector<std::shared_ptr<monero_tx_wallet>>& txs, const std::vector<std::shared_ptr<monero_tx_wallet>>& other_txs) {
+  std::vector<std::shared_ptr<monero_tx_wallet>> merged_txs;
+  merged_txs.reserve(txs.size() + other_txs.size());
+  std::unordered_map<std::string, std::shared_ptr<monero_tx_wallet>> tx_map;
+  tx_map.reserve(txs.size() + other_txs.size());
+
+  for (const auto* source : { &txs, &other_txs }) {
+    for (const auto& tx : *source) {
+      if (tx == nullptr) continue;
+      if (tx->m_hash == boost::none) {
+        merged_txs.push_back(tx);
+        continue;
+      }
+      auto it = tx_map.find(tx->m_hash.get());
+      if (it == tx_map.end()) {
+        tx_map.emplace(tx->m_hash.get(), tx);
+        merged_txs.push_back(tx);
+      }
+      else if (it->second != tx) it->second->merge(it->second, tx);
+    }
+  }
+
+  std::stable_sort(merged_txs.begin(), merged_txs.end(), monero_tx_height_comparator());
+  return merged_txs;
+}
+
 std::vector<std::shared_ptr<monero_tx_wallet>> PyMoneroUtils::get_and_sort_txs(const monero_wallet& wallet, const std::vector<std::string>& tx_hashes) {
   monero_tx_query tx_query;
   tx_query.m_hashes = tx_hashes;
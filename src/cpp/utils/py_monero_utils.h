@@ -72,6 +72,7 @@ public:
   static void sort_txs_wallet(std::vector<std::shared_ptr<monero_tx_wallet>>& txs, const std::vector<std::string>& hashes);
   static std::vector<std::shared_ptr<monero_tx_wallet>> get_and_sort_txs(const monero_wallet& wallet, const std::vector<std::string>& tx_hashes);
   static std::vector<std::shared_ptr<monero_tx_wallet>> get_and_sort_txs(const monero_wallet& wallet, const monero_tx_query& tx_query);
+  static std::vector<std::shared_ptr<monero_tx_wallet>> merge_txs(const std::vector<std::shared_ptr<monero_tx_wallet>>& txs, const std::vector<std::shared_ptr<monero_tx_wallet>>& other_txs);
 
   template <typename Parent, typename Child>
   static void set_query(std::shared_ptr<Parent>& self, std::shared_ptr<Child>& field, const boost::optional<std::shared_ptr<Child>>& val) {
@@ -128,6 +128,9 @@ void py_monero_bind_utils(py::module_& m, PyMoneroTypes& t) {
     .def_static("get_blocks_from_outputs", [](const std::vector<std::shared_ptr<monero_output_wallet>>& outputs) {
       MONERO_CATCH_AND_RETHROW(monero_utils::get_blocks_from_outputs(outputs));
     }, py::arg("outputs"))
+    .def_static("merge_txs", [](const std::vector<std::shared_ptr<monero_tx_wallet>>& txs, const std::vector<std::shared_ptr<monero_tx_wallet>>& other_txs) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroUtils::merge_txs(txs, other_txs));
+    }, py::arg("txs"), py::arg("other_txs"), py::call_guard<py::gil_scoped_release>())
     .def_static("get_payment_uri", [](const monero_tx_config &config, monero_network_type network_type) {
       MONERO_CATCH_AND_RETHROW(monero_utils::get_payment_uri(config, network_type));
     }, py::arg("config"), py::arg("network_type") = monero_network_type::MAINNET)
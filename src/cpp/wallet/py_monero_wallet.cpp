@@ -0,0 +1,1744 @@
+/**
+ * Copyright (c) everoddandeven
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Parts of this file are originally copyright (c) 2025-2026 woodser
+ *
+ * Parts of this file are originally copyright (c) 2014-2019, The Monero Project
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are
+ * permitted provided that the following conditions are met:
+ *
+ * All rights reserved.
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
+ */
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include "wallet/monero_wallet_full.h"
+#include "wallet/wallet2.h"
+#include "daemon/monero_daemon_rpc.h"
+#include "cryptonote_basic/cryptonote_basic_impl.h"
+#include "utils/monero_utils.h"
+#include "py_monero_wallet.h"
+
+// --------------------------- WALLET STATE ---------------------------
+
+std::mutex PyMoneroWalletState::s_mutex;
+std::unordered_map<const monero_wallet*, std::shared_ptr<PyMoneroWalletState>> PyMoneroWalletState::s_states;
+
+std::shared_ptr<PyMoneroWalletState> PyMoneroWalletState::get(const std::shared_ptr<monero_wallet>& wallet) {
+  std::lock_guard<std::mutex> lock(s_mutex);
+
+  // states of destroyed wallets are dropped, so a wallet created at a freed address starts fresh
+  for (auto it = s_states.begin(); it != s_states.end();) {
+    if (it->second->m_wallet.expired()) it = s_states.erase(it);
+    else ++it;
+  }
+  auto& state = s_states[wallet.get()];
+  if (state == nullptr) {
+    state = std::make_shared<PyMoneroWalletState>();
+    state->m_wallet = wallet;
+  }
+  return state;
+}
+
+void PyMoneroWalletState::remove(const monero_wallet* wallet) {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_states.erase(wallet);
+}
+
+// --------------------------- SYNC CANCELLATION ---------------------------
+
+void monero_cancellable_sync_listener::stop_if_cancelled() {
+  if (!m_cancelled.load() || m_stopped.exchange(true)) return;
+  m_wallet.stop_syncing();
+}
+
+void monero_cancellable_sync_listener::restore_syncing() {
+  // stopping the sync also disabled background syncing
+  if (!m_stopped.load()) return;
+  uint64_t sync_period_in_ms = m_state->m_sync_period_in_ms.load();
+  if (sync_period_in_ms > 0 && !m_wallet.is_closed()) m_wallet.start_syncing(sync_period_in_ms);
+}
+
+void monero_cancellable_sync_listener::on_sync_progress(uint64_t height, uint64_t start_height, uint64_t end_height, double percent_done, const std::string& message) {
+  if (m_listener != nullptr) m_listener->on_sync_progress(height, start_height, end_height, percent_done, message);
+  stop_if_cancelled();
+}
+
+void monero_cancellable_sync_listener::on_new_block(uint64_t height) {
+  if (m_listener != nullptr) m_listener->on_new_block(height);
+  stop_if_cancelled();
+}
+
+void monero_cancellable_sync_listener::on_balances_changed(uint64_t new_balance, uint64_t new_unlocked_balance) {
+  if (m_listener != nullptr) m_listener->on_balances_changed(new_balance, new_unlocked_balance);
+}
+
+void monero_cancellable_sync_listener::on_output_received(const monero_output_wallet& output) {
+  if (m_listener != nullptr) m_listener->on_output_received(output);
+}
+
+void monero_cancellable_sync_listener::on_output_spent(const monero_output_wallet& output) {
+  if (m_listener != nullptr) m_listener->on_output_spent(output);
+}
+
+// --------------------------- PARTITION SCAN ---------------------------
+
+/**
+ * Stops a partition wallet once it scans past the end of its partition.
+ */
+class monero_partition_sync_listener : public monero_wallet_listener {
+public:
+  monero_partition_sync_listener(monero_wallet_full& wallet, uint32_t partition_idx, uint64_t start_height, uint64_t end_height, const std::atomic<bool>& failed, monero_partition_scan_listener* listener) :
+    m_wallet(wallet), m_partition_idx(partition_idx), m_start_height(start_height), m_end_height(end_height), m_failed(failed), m_listener(listener) {
+    m_start_time = std::chrono::steady_clock::now();
+    m_last_notified = m_start_time;
+  }
+
+  void on_new_block(uint64_t height) override {
+    bool done = height + 1 >= m_end_height;
+    if (m_listener != nullptr) {
+      auto now = std::chrono::steady_clock::now();
+      if (done || now - m_last_notified >= std::chrono::seconds(1)) {
+        m_last_notified = now;
+        double elapsed = std::chrono::duration<double>(now - m_start_time).count();
+        double blocks_per_second = elapsed > 0 ? (height + 1 - m_start_height) / elapsed : 0;
+        m_listener->on_partition_progress(m_partition_idx, height, m_start_height, m_end_height, blocks_per_second);
+      }
+    }
+
+    // wallet2 fetches blocks in batches, so the partition may overshoot its end height
+    if (done || m_failed.load()) m_wallet.stop_syncing();
+  }
+
+private:
+  monero_wallet_full& m_wallet;
+  uint32_t m_partition_idx;
+  uint64_t m_start_height;
+  uint64_t m_end_height;
+  const std::atomic<bool>& m_failed;
+  monero_partition_scan_listener* m_listener;
+  std::chrono::steady_clock::time_point m_start_time;
+  std::chrono::steady_clock::time_point m_last_notified;
+};
+
+monero_partition_scan_result PyMoneroWalletUtils::scan_partitioned(const monero_wallet& wallet, uint64_t start_height, const boost::optional<uint64_t>& end_height, uint32_t num_partitions, monero_partition_scan_listener* listener) {
+  auto connection = wallet.get_daemon_connection();
+  if (connection == nullptr) throw std::runtime_error("Wallet is not connected to daemon");
+  if (num_partitions == 0) num_partitions = std::max<uint32_t>(1, std::thread::hardware_concurrency());
+
+  monero_partition_scan_result result;
+  result.m_start_height = start_height;
+  result.m_end_height = end_height != boost::none ? end_height.get() : wallet.get_daemon_height();
+  if (result.m_end_height <= start_height) throw std::runtime_error("End height must be greater than start height");
+  uint64_t num_blocks = result.m_end_height - start_height;
+  if (num_partitions > num_blocks) num_partitions = (uint32_t)num_blocks;
+  result.m_num_partitions = num_partitions;
+
+  // partition wallets scan with the view key, plus the spend key when available to compute key images
+  bool view_only = wallet.is_view_only();
+  monero_wallet_config config;
+  config.m_path = std::string("");
+  config.m_password = std::string("");
+  config.m_network_type = wallet.get_network_type();
+  config.m_primary_address = wallet.get_primary_address();
+  config.m_private_view_key = wallet.get_private_view_key();
+  if (!view_only) config.m_private_spend_key = wallet.get_private_spend_key();
+  config.m_server = *connection;
+
+  std::vector<std::vector<std::shared_ptr<monero_tx_wallet>>> partition_txs(num_partitions);
+  std::vector<std::vector<std::shared_ptr<monero_output_wallet>>> partition_outputs(num_partitions);
+  std::vector<std::exception_ptr> errors(num_partitions);
+  std::atomic<bool> failed(false);
+  std::atomic<uint32_t> next_partition(0);
+  uint64_t partition_size = num_blocks / num_partitions;
+
+  // partitions are claimed by pool workers, so a busy pool scans them with fewer threads
+  PyMoneroThreadPool::get_instance().parallel_for(num_partitions, [&](size_t /* worker_idx */) {
+    for (uint32_t i = next_partition++; i < num_partitions; i = next_partition++) {
+      uint64_t partition_start = start_height + i * partition_size;
+      uint64_t partition_end = i + 1 == num_partitions ? result.m_end_height : partition_start + partition_size;
+      try {
+        monero_wallet_config partition_config = config;
+        partition_config.m_restore_height = partition_start;
+        std::unique_ptr<monero_wallet_full> partition_wallet(monero_wallet_full::create_wallet(partition_config));
+        monero_partition_sync_listener sync_listener(*partition_wallet, i, partition_start, partition_end, failed, listener);
+        partition_wallet->sync(partition_start, sync_listener);
+
+        // keep only what was found inside the partition
+        auto in_partition = [&](const std::shared_ptr<monero_tx>& tx) {
+          boost::optional<uint64_t> height = tx == nullptr ? boost::none : tx->get_height();
+          return height != boost::none && height.get() >= partition_start && height.get() < partition_end;
+        };
+        for (const auto& tx : partition_wallet->get_txs()) {
+          if (in_partition(tx)) partition_txs[i].push_back(tx);
+        }
+        for (const auto& output : partition_wallet->get_outputs(monero_output_query())) {
+          if (in_partition(output->m_tx)) partition_outputs[i].push_back(output);
+        }
+        partition_wallet->close(false);
+      } catch (...) {
+        errors[i] = std::current_exception();
+        failed.store(true);
+      }
+    }
+  });
+
+  for (const auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+
+  // merge partitions in height order
+  for (uint32_t i = 0; i < num_partitions; i++) {
+    result.m_txs.insert(result.m_txs.end(), partition_txs[i].begin(), partition_txs[i].end());
+    result.m_outputs.insert(result.m_outputs.end(), partition_outputs[i].begin(), partition_outputs[i].end());
+  }
+  std::stable_sort(result.m_txs.begin(), result.m_txs.end(), monero_tx_height_comparator());
+  std::stable_sort(result.m_outputs.begin(), result.m_outputs.end(), [](const std::shared_ptr<monero_output_wallet>& o1, const std::shared_ptr<monero_output_wallet>& o2) {
+    return o1->m_tx->get_height().get() < o2->m_tx->get_height().get();
+  });
+
+  // outputs may be spent by a later partition, so compute spends from their key images; only
+  // spends confirmed in the blockchain count since pool spends can still be dropped
+  if (!view_only) {
+    std::vector<std::string> key_images;
+    std::vector<std::shared_ptr<monero_output_wallet>> outputs;
+    for (const auto& output : result.m_outputs) {
+      if (output->m_key_image == nullptr || output->m_key_image->m_hex == boost::none) continue;
+      key_images.push_back(output->m_key_image->m_hex.get());
+      outputs.push_back(output);
+    }
+    if (!key_images.empty()) {
+      monero_daemon_rpc daemon(connection);
+      auto statuses = daemon.get_key_image_spent_statuses(key_images);
+      for (size_t i = 0; i < statuses.size() && i < outputs.size(); i++) {
+        outputs[i]->m_is_spent = statuses[i] == monero_key_image_spent_status::CONFIRMED;
+      }
+    }
+  }
+
+  return result;
+}
+
+// --------------------------- OUTPUT COLUMNS ---------------------------
+
+monero_output_columns PyMoneroWalletUtils::get_outputs_columns(const monero_wallet& wallet, const monero_output_query& query) {
+  monero_output_columns columns;
+  std::vector<std::shared_ptr<monero_output_wallet>> outputs = wallet.get_outputs(query);
+  size_t num_outputs = outputs.size();
+  columns.m_amounts.reserve(num_outputs);
+  columns.m_key_images.reserve(num_outputs);
+  columns.m_account_indices.reserve(num_outputs);
+  columns.m_subaddress_indices.reserve(num_outputs);
+  columns.m_is_spent.reserve(num_outputs);
+  columns.m_is_frozen.reserve(num_outputs);
+  columns.m_is_unlocked.reserve(num_outputs);
+  columns.m_heights.reserve(num_outputs);
+  for (const auto& output : outputs) {
+    auto tx = std::static_pointer_cast<monero_tx_wallet>(output->m_tx);
+    boost::optional<uint64_t> height = tx == nullptr ? boost::none : tx->get_height();
+    columns.m_amounts.push_back(output->m_amount.value_or(0));
+    columns.m_key_images.push_back(output->m_key_image != nullptr && output->m_key_image->m_hex != boost::none ? output->m_key_image->m_hex.get() : std::string(""));
+    columns.m_account_indices.push_back(output->m_account_index.value_or(0));
+    columns.m_subaddress_indices.push_back(output->m_subaddress_index.value_or(0));
+    columns.m_is_spent.push_back(output->m_is_spent.value_or(false) ? 1 : 0);
+    columns.m_is_frozen.push_back(output->m_is_frozen.value_or(false) ? 1 : 0);
+    columns.m_is_unlocked.push_back(tx != nullptr && tx->m_is_locked == false ? 1 : 0);
+    columns.m_heights.push_back(height.value_or(0));
+  }
+  return columns;
+}
+
+// --------------------------- TX BATCH ---------------------------
+
+void PyMoneroWalletUtils::run_with_clones(monero_wallet& wallet, size_t num_items, uint32_t num_threads, const std::function<void(monero_wallet&, size_t)>& task) {
+  PyMoneroThreadPool& pool = PyMoneroThreadPool::get_instance();
+  size_t num_workers = num_threads == 0 ? pool.get_num_threads() + 1 : num_threads;
+  num_workers = std::min(num_workers, num_items);
+
+  // only connected full wallets can be cloned into additional workers
+  bool cloneable = num_workers > 1 && dynamic_cast<monero_wallet_full*>(&wallet) != nullptr && wallet.get_daemon_connection() != nullptr;
+  if (!cloneable) {
+    for (size_t i = 0; i < num_items; i++) task(wallet, i);
+    return;
+  }
+
+  monero_wallet_config config;
+  config.m_path = std::string("");
+  config.m_password = std::string("");
+  config.m_network_type = wallet.get_network_type();
+  config.m_primary_address = wallet.get_primary_address();
+  config.m_private_view_key = wallet.get_private_view_key();
+  config.m_server = *wallet.get_daemon_connection();
+
+  std::atomic<size_t> next_idx(0);
+  pool.parallel_for(num_workers, [&](size_t worker_idx) {
+    // first worker uses the wallet itself, others use in-memory clones closed with the batch
+    std::unique_ptr<monero_wallet> clone;
+    monero_wallet* worker_wallet = &wallet;
+    if (worker_idx > 0) {
+      clone.reset(monero_wallet_full::create_wallet(config));
+      worker_wallet = clone.get();
+    }
+    try {
+      for (size_t i = next_idx++; i < num_items; i = next_idx++) task(*worker_wallet, i);
+    } catch (...) {
+      if (clone != nullptr) clone->close(false);
+      throw;
+    }
+    if (clone != nullptr) clone->close(false);
+  });
+}
+
+monero_tx_batch_result PyMoneroWalletUtils::create_txs_batch(monero_wallet& wallet, const std::vector<std::shared_ptr<monero_tx_config>>& configs) {
+  monero_tx_batch_result result;
+  result.m_txs.resize(configs.size());
+  result.m_errors.resize(configs.size());
+
+  // inputs selected for a config are frozen so later configs cannot select them
+  std::vector<std::string> frozen_key_images;
+  try {
+    for (size_t i = 0; i < configs.size(); i++) {
+      try {
+        if (configs[i] == nullptr) throw std::runtime_error("Must provide tx config");
+        result.m_txs[i] = wallet.create_txs(*configs[i]);
+      } catch (const std::exception& e) {
+        result.m_errors[i] = std::string(e.what());
+        continue;
+      }
+      for (const auto& tx : result.m_txs[i]) {
+        for (const auto& input : tx->m_inputs) {
+          if (input == nullptr || input->m_key_image == nullptr || input->m_key_image->m_hex == boost::none) continue;
+          const std::string& key_image = input->m_key_image->m_hex.get();
+          if (wallet.is_output_frozen(key_image)) continue;
+          wallet.freeze_output(key_image);
+          frozen_key_images.push_back(key_image);
+        }
+      }
+    }
+  } catch (...) {
+    for (const auto& key_image : frozen_key_images) {
+      try { wallet.thaw_output(key_image); } catch (...) { }
+    }
+    throw;
+  }
+  for (const auto& key_image : frozen_key_images) wallet.thaw_output(key_image);
+  return result;
+}
+
+monero_tx_set_batch_result PyMoneroWalletUtils::sign_txs_batch(monero_wallet& wallet, const std::vector<std::string>& unsigned_tx_hexes) {
+  // errors of the wallet itself are raised, errors of single tx sets are reported per set
+  if (wallet.is_view_only()) throw std::runtime_error("Cannot sign transactions with a view-only wallet");
+  monero_tx_set_batch_result result;
+  result.m_tx_sets.resize(unsigned_tx_hexes.size());
+  result.m_errors.resize(unsigned_tx_hexes.size());
+
+  // signing imports the outputs carried by each set into the signer, which must be the wallet
+  // itself so it can export their key images afterwards
+  for (size_t i = 0; i < unsigned_tx_hexes.size(); i++) {
+    try {
+      result.m_tx_sets[i] = wallet.sign_txs(unsigned_tx_hexes[i]);
+    } catch (const std::exception& e) {
+      result.m_errors[i] = std::string(e.what());
+    }
+  }
+  return result;
+}
+
+// --------------------------- PROOF BATCH ---------------------------
+
+monero_check_batch_result PyMoneroWalletUtils::run_checks(monero_wallet& wallet, size_t num_checks, uint32_t num_threads, const std::function<std::shared_ptr<monero_check>(monero_wallet&, size_t)>& check) {
+  monero_check_batch_result result;
+  result.m_checks.resize(num_checks);
+  result.m_errors.resize(num_checks);
+
+  // an invalid proof is a check which is not good, a check which cannot be performed is an error
+  run_with_clones(wallet, num_checks, num_threads, [&](monero_wallet& verifier, size_t i) {
+    try {
+      result.m_checks[i] = check(verifier, i);
+    } catch (const std::exception& e) {
+      result.m_errors[i] = std::string(e.what());
+    }
+  });
+  return result;
+}
+
+monero_check_batch_result PyMoneroWalletUtils::check_tx_keys(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+  return run_checks(wallet, checks.size(), num_threads, [&](monero_wallet& verifier, size_t i) -> std::shared_ptr<monero_check> {
+    return verifier.check_tx_key(std::get<0>(checks[i]), std::get<1>(checks[i]), std::get<2>(checks[i]));
+  });
+}
+
+monero_check_batch_result PyMoneroWalletUtils::check_tx_proofs(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+  return run_checks(wallet, checks.size(), num_threads, [&](monero_wallet& verifier, size_t i) -> std::shared_ptr<monero_check> {
+    return verifier.check_tx_proof(std::get<0>(checks[i]), std::get<1>(checks[i]), std::get<2>(checks[i]), std::get<3>(checks[i]));
+  });
+}
+
+monero_check_batch_result PyMoneroWalletUtils::check_spend_proofs(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+  return run_checks(wallet, checks.size(), num_threads, [&](monero_wallet& verifier, size_t i) {
+    auto check = std::make_shared<monero_check>();
+    check->m_is_good = verifier.check_spend_proof(std::get<0>(checks[i]), std::get<1>(checks[i]), std::get<2>(checks[i]));
+    return check;
+  });
+}
+
+monero_check_batch_result PyMoneroWalletUtils::check_reserve_proofs(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+  return run_checks(wallet, checks.size(), num_threads, [&](monero_wallet& verifier, size_t i) -> std::shared_ptr<monero_check> {
+    return verifier.check_reserve_proof(std::get<0>(checks[i]), std::get<1>(checks[i]), std::get<2>(checks[i]));
+  });
+}
+
+// --------------------------- MESSAGE BATCH ---------------------------
+
+monero_message_batch_result PyMoneroWalletUtils::verify_messages(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& messages, uint32_t num_threads) {
+  monero_message_batch_result result;
+  result.m_results.resize(messages.size());
+  result.m_errors.resize(messages.size());
+  if (messages.empty()) return result;
+
+  // other wallets verify each message themselves
+  if (dynamic_cast<monero_wallet_full*>(&wallet) == nullptr) {
+    for (size_t i = 0; i < messages.size(); i++) {
+      try {
+        result.m_results[i] = std::make_shared<monero_message_signature_result>(wallet.verify_message(std::get<0>(messages[i]), std::get<1>(messages[i]), std::get<2>(messages[i])));
+      } catch (const std::exception& e) {
+        result.m_errors[i] = std::string(e.what());
+      }
+    }
+    return result;
+  }
+
+  // decode each distinct address once, element references stay valid as the map grows
+  cryptonote::network_type network_type = static_cast<cryptonote::network_type>(wallet.get_network_type());
+  std::unordered_map<std::string, boost::optional<cryptonote::account_public_address>> addresses;
+  std::vector<const cryptonote::account_public_address*> decoded(messages.size(), nullptr);
+  for (size_t i = 0; i < messages.size(); i++) {
+    const std::string& address = std::get<1>(messages[i]);
+    auto it = addresses.find(address);
+    if (it == addresses.end()) {
+      cryptonote::address_parse_info info;
+      bool is_valid = cryptonote::get_account_address_from_str(info, network_type, address);
+      it = addresses.emplace(address, is_valid ? boost::make_optional(info.address) : boost::none).first;
+    }
+    if (it->second == boost::none) result.m_errors[i] = std::string("Invalid address");
+    else decoded[i] = &it->second.get();
+  }
+
+  // wallet2::verify() is const and only reads its arguments, so one keyless verifier
+  // is shared by all workers instead of the wallet, which may be syncing meanwhile
+  tools::wallet2 verifier(network_type, 1, true);
+  auto verify = [&](size_t i) {
+    if (decoded[i] == nullptr) return;
+    tools::wallet2::message_signature_result_t w2_result = verifier.verify(std::get<0>(messages[i]), *decoded[i], std::get<2>(messages[i]));
+    auto signature_result = std::make_shared<monero_message_signature_result>();
+    signature_result->m_is_good = w2_result.valid;
+    signature_result->m_version = w2_result.version;
+    signature_result->m_is_old = w2_result.old;
+    signature_result->m_signature_type = w2_result.type == tools::wallet2::message_signature_type_t::sign_with_view_key ? monero_message_signature_type::SIGN_WITH_VIEW_KEY : monero_message_signature_type::SIGN_WITH_SPEND_KEY;
+    result.m_results[i] = signature_result;
+  };
+
+  PyMoneroThreadPool& pool = PyMoneroThreadPool::get_instance();
+  size_t num_workers = std::min<size_t>(num_threads == 0 ? pool.get_num_threads() + 1 : num_threads, messages.size());
+  std::atomic<size_t> next_idx(0);
+  pool.parallel_for(num_workers, [&](size_t worker_idx) {
+    for (size_t i = next_idx++; i < messages.size(); i = next_idx++) verify(i);
+  });
+  return result;
+}
+
+// --------------------------- KEY IMAGE IMPORT ---------------------------
+
+void PyMoneroWalletUtils::merge_key_image_import_result(monero_key_image_import_result& result, const monero_key_image_import_result& chunk_result) {
+  if (chunk_result.m_height != boost::none && (result.m_height == boost::none || chunk_result.m_height.get() > result.m_height.get())) result.m_height = chunk_result.m_height;
+  if (chunk_result.m_spent_amount != boost::none) result.m_spent_amount = result.m_spent_amount.value_or(0) + chunk_result.m_spent_amount.get();
+  if (chunk_result.m_unspent_amount != boost::none) result.m_unspent_amount = result.m_unspent_amount.value_or(0) + chunk_result.m_unspent_amount.get();
+}
+
+// --------------------------- BALANCE INDEX ---------------------------
+
+std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> PyMoneroWalletUtils::get_balances(const monero_wallet& wallet) {
+  std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> balances;
+  for (const auto& account : wallet.get_accounts(true)) {
+    for (const auto& subaddress : account.m_subaddresses) {
+      if (subaddress.m_account_index == boost::none || subaddress.m_index == boost::none) continue;
+      balances[std::make_pair(subaddress.m_account_index.get(), subaddress.m_index.get())] = std::make_pair(subaddress.m_balance.value_or(0), subaddress.m_unlocked_balance.value_or(0));
+    }
+  }
+  return balances;
+}
+
+monero_balance_index::monero_balance_index(const std::shared_ptr<monero_wallet>& wallet) : m_wallet(wallet), m_stale(true) {
+  if (m_wallet == nullptr) throw std::runtime_error("Must provide wallet");
+  m_wallet->add_listener(*this);
+}
+
+monero_balance_index::~monero_balance_index() {
+  try {
+    close();
+  } catch (...) { }
+}
+
+void monero_balance_index::close() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_closed.exchange(true)) return;
+    m_balances.clear();
+  }
+  // the wallet is called without the lock, notifications may be waiting on it
+  if (!m_wallet->is_closed()) m_wallet->remove_listener(*this);
+}
+
+void monero_balance_index::refresh() {
+  if (m_closed) throw std::runtime_error("Balance index is closed");
+
+  // read the wallet without the lock, notifications received meanwhile mark the table stale again
+  m_num_refreshing++;
+  m_stale = false;
+  std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> balances;
+  try {
+    balances = PyMoneroWalletUtils::get_balances(*m_wallet);
+  } catch (...) {
+    m_num_refreshing--;
+    m_stale = true;
+    throw;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_num_refreshing--;
+  if (m_closed) throw std::runtime_error("Balance index is closed");
+  m_balances.clear();
+  m_balance = 0;
+  m_unlocked_balance = 0;
+  for (const auto& entry : balances) {
+    m_balances[(static_cast<uint64_t>(entry.first.first) << 32) | entry.first.second] = entry.second;
+    m_balance += entry.second.first;
+    m_unlocked_balance += entry.second.second;
+  }
+}
+
+void monero_balance_index::refresh_if_stale() {
+  if (m_stale || m_closed) refresh();
+}
+
+void monero_balance_index::apply_delta(const monero_output_wallet& output, bool is_spent) {
+  if (output.m_account_index == boost::none || output.m_subaddress_index == boost::none || output.m_amount == boost::none) {
+    m_stale = true;
+    return;
+  }
+
+  // received outputs count once confirmed, wallet2 leaves incoming pool txs out of balances
+  if (!is_spent && (output.m_tx == nullptr || output.m_tx->m_is_confirmed != true)) return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_closed) return;
+  // a rebuild in progress may have read the wallet before this output
+  if (m_num_refreshing > 0) m_stale = true;
+  uint64_t amount = output.m_amount.get();
+  auto& entry = m_balances[(static_cast<uint64_t>(output.m_account_index.get()) << 32) | output.m_subaddress_index.get()];
+  if (is_spent) {
+    uint64_t unlocked_amount = std::min(amount, entry.second);
+    amount = std::min(amount, entry.first);
+    entry.first -= amount;
+    entry.second -= unlocked_amount;
+    m_balance -= amount;
+    m_unlocked_balance -= unlocked_amount;
+  }
+  else {
+    // received outputs are locked
+    entry.first += amount;
+    m_balance += amount;
+  }
+}
+
+void monero_balance_index::on_output_received(const monero_output_wallet& output) {
+  apply_delta(output, false);
+}
+
+void monero_balance_index::on_output_spent(const monero_output_wallet& output) {
+  apply_delta(output, true);
+}
+
+void monero_balance_index::on_balances_changed(uint64_t new_balance, uint64_t new_unlocked_balance) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_balance != new_balance || m_unlocked_balance != new_unlocked_balance) m_stale = true;
+}
+
+const std::pair<uint64_t, uint64_t>& monero_balance_index::get_entry(uint32_t account_idx, uint32_t subaddress_idx) {
+  static const std::pair<uint64_t, uint64_t> EMPTY_ENTRY(0, 0);
+  auto it = m_balances.find((static_cast<uint64_t>(account_idx) << 32) | subaddress_idx);
+  return it == m_balances.end() ? EMPTY_ENTRY : it->second;
+}
+
+uint64_t monero_balance_index::get_balance(uint32_t account_idx, uint32_t subaddress_idx) {
+  refresh_if_stale();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return get_entry(account_idx, subaddress_idx).first;
+}
+
+uint64_t monero_balance_index::get_unlocked_balance(uint32_t account_idx, uint32_t subaddress_idx) {
+  refresh_if_stale();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return get_entry(account_idx, subaddress_idx).second;
+}
+
+std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> monero_balance_index::get_balances() {
+  refresh_if_stale();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> balances;
+  for (const auto& entry : m_balances) {
+    balances[std::make_pair(static_cast<uint32_t>(entry.first >> 32), static_cast<uint32_t>(entry.first & 0xffffffff))] = entry.second;
+  }
+  return balances;
+}
+
+// --------------------------- SUBADDRESS LOOKUP ---------------------------
+
+std::vector<monero_subaddress> PyMoneroWalletUtils::create_subaddresses(monero_wallet& wallet, uint32_t account_idx, uint32_t count, const std::vector<std::string>& labels) {
+  if (!labels.empty() && labels.size() != 1 && labels.size() != count) throw std::runtime_error("Must provide no label, one label or one label per subaddress");
+  std::vector<monero_subaddress> subaddresses;
+  subaddresses.reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    std::string label = labels.empty() ? std::string("") : labels.size() == 1 ? labels[0] : labels[i];
+    subaddresses.push_back(wallet.create_subaddress(account_idx, label));
+  }
+  return subaddresses;
+}
+
+monero_subaddress_lookup::monero_subaddress_lookup(const std::shared_ptr<monero_wallet>& wallet) : m_wallet(wallet) {
+  if (m_wallet == nullptr) throw std::runtime_error("Must provide wallet");
+  m_network_type = m_wallet->get_network_type();
+  refresh();
+}
+
+void monero_subaddress_lookup::refresh() {
+  std::vector<monero_subaddress> subaddresses;
+  for (const auto& account : m_wallet->get_accounts()) {
+    if (account.m_index == boost::none) continue;
+    auto account_subaddresses = m_wallet->get_subaddresses(account.m_index.get());
+    subaddresses.insert(subaddresses.end(), account_subaddresses.begin(), account_subaddresses.end());
+  }
+
+  // build the replacement table unlocked so lookups keep using the current one until it is swapped in
+  std::vector<spend_key> keys = get_spend_keys(subaddresses);
+  table replacement;
+  replacement.reserve(subaddresses.size());
+  for (size_t i = 0; i < subaddresses.size(); i++) {
+    replacement.insert(keys[i], subaddresses[i].m_account_index.get(), subaddresses[i].m_index.get());
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::swap(m_table, replacement);
+}
+
+void monero_subaddress_lookup::add_subaddresses(const std::vector<monero_subaddress>& subaddresses) {
+  // decode addresses before locking the table
+  std::vector<spend_key> keys = get_spend_keys(subaddresses);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_table.reserve(m_table.m_size + subaddresses.size());
+  for (size_t i = 0; i < subaddresses.size(); i++) {
+    m_table.insert(keys[i], subaddresses[i].m_account_index.get(), subaddresses[i].m_index.get());
+  }
+}
+
+std::vector<monero_subaddress> monero_subaddress_lookup::create_subaddresses(uint32_t account_idx, uint32_t count, const std::vector<std::string>& labels) {
+  auto subaddresses = PyMoneroWalletUtils::create_subaddresses(*m_wallet, account_idx, count, labels);
+  add_subaddresses(subaddresses);
+  return subaddresses;
+}
+
+monero_subaddress monero_subaddress_lookup::get_address_index(const std::string& address) const {
+  spend_key key;
+  if (!get_spend_key(address, key)) throw std::runtime_error("Invalid address");
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const entry* found = m_table.find(key);
+  if (found == nullptr) throw std::runtime_error("Address doesn't belong to the wallet");
+  monero_subaddress subaddress;
+  subaddress.m_address = address;
+  subaddress.m_account_index = found->m_account_idx;
+  subaddress.m_index = found->m_subaddress_idx;
+  return subaddress;
+}
+
+bool monero_subaddress_lookup::contains(const std::string& address) const {
+  spend_key key;
+  if (!get_spend_key(address, key)) return false;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_table.find(key) != nullptr;
+}
+
+size_t monero_subaddress_lookup::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_table.m_size;
+}
+
+size_t monero_subaddress_lookup::get_capacity() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_table.m_tags.size();
+}
+
+bool monero_subaddress_lookup::get_spend_key(const std::string& address, spend_key& key) const {
+  cryptonote::address_parse_info info;
+  if (!cryptonote::get_account_address_from_str(info, static_cast<cryptonote::network_type>(m_network_type), address)) return false;
+  std::memcpy(key.data(), info.address.m_spend_public_key.data, key.size());
+  return true;
+}
+
+std::vector<monero_subaddress_lookup::spend_key> monero_subaddress_lookup::get_spend_keys(const std::vector<monero_subaddress>& subaddresses) const {
+  std::vector<spend_key> keys(subaddresses.size());
+  for (size_t i = 0; i < subaddresses.size(); i++) {
+    const auto& subaddress = subaddresses[i];
+    if (subaddress.m_address == boost::none || subaddress.m_account_index == boost::none || subaddress.m_index == boost::none) throw std::runtime_error("Subaddress must have address, account index and index");
+    if (!get_spend_key(subaddress.m_address.get(), keys[i])) throw std::runtime_error("Invalid address: " + subaddress.m_address.get());
+  }
+  return keys;
+}
+
+namespace {
+  // spend keys are uniformly distributed, so their first bytes are a good hash
+  inline uint64_t get_spend_key_hash(const std::array<uint8_t, 32>& key) {
+    uint64_t hash;
+    std::memcpy(&hash, key.data(), sizeof(hash));
+    return hash;
+  }
+
+  // non-zero tag from the top hash bits, zero marks an empty slot
+  inline uint8_t get_spend_key_tag(uint64_t hash) {
+    return static_cast<uint8_t>(0x80 | (hash >> 57));
+  }
+}
+
+const monero_subaddress_lookup::entry* monero_subaddress_lookup::table::find(const spend_key& key) const {
+  if (m_tags.empty()) return nullptr;
+  uint64_t hash = get_spend_key_hash(key);
+  uint8_t tag = get_spend_key_tag(hash);
+  size_t mask = m_tags.size() - 1;
+  for (size_t i = hash & mask; m_tags[i] != 0; i = (i + 1) & mask) {
+    if (m_tags[i] == tag && m_entries[i].m_spend_key == key) return &m_entries[i];
+  }
+  return nullptr;
+}
+
+void monero_subaddress_lookup::table::insert(const spend_key& key, uint32_t account_idx, uint32_t subaddress_idx) {
+  uint64_t hash = get_spend_key_hash(key);
+  uint8_t tag = get_spend_key_tag(hash);
+  size_t mask = m_tags.size() - 1;
+  size_t i = hash & mask;
+  for (; m_tags[i] != 0; i = (i + 1) & mask) {
+    if (m_tags[i] == tag && m_entries[i].m_spend_key == key) break;
+  }
+  if (m_tags[i] == 0) m_size++;
+  m_tags[i] = tag;
+  m_entries[i] = entry{key, account_idx, subaddress_idx};
+}
+
+void monero_subaddress_lookup::table::reserve(size_t size) {
+  // keep the load factor at or below 3/4
+  size_t capacity = 16;
+  while (capacity * 3 < size * 4) capacity <<= 1;
+  if (capacity <= m_tags.size()) return;
+
+  std::vector<uint8_t> tags(capacity, 0);
+  std::vector<entry> entries(capacity);
+  std::swap(tags, m_tags);
+  std::swap(entries, m_entries);
+  m_size = 0;
+  for (size_t i = 0; i < tags.size(); i++) {
+    if (tags[i] != 0) insert(entries[i].m_spend_key, entries[i].m_account_idx, entries[i].m_subaddress_idx);
+  }
+}
+
+// --------------------------- MODEL DESERIALIZATION ---------------------------
+
+// graphs read with use_arena are allocated from one arena per call, which is private to the reader
+namespace {
+
+/**
+ * Bump-pointer arena for object graphs which are created together and released together.
+ *
+ * Memory is only returned when the arena is destroyed, i.e. when the last object allocated
+ * from it is destroyed. Allocation is not thread-safe.
+ */
+class monero_arena {
+public:
+  explicit monero_arena(size_t chunk_size = 64 * 1024) : m_chunk_size(chunk_size) { }
+
+  void* allocate(size_t size, size_t alignment);
+
+  /**
+   * Get the arena of the current thread's innermost monero_arena_scope, or nullptr.
+   */
+  static std::shared_ptr<monero_arena> get_current() { return s_current; }
+
+private:
+  friend class monero_arena_scope;
+  static thread_local std::shared_ptr<monero_arena> s_current;
+
+  size_t m_chunk_size;
+  std::vector<std::unique_ptr<char[]>> m_chunks;
+  char* m_next = nullptr;
+  size_t m_available = 0;
+};
+
+/**
+ * Makes an arena current on this thread for the lifetime of the scope.
+ */
+class monero_arena_scope {
+public:
+  explicit monero_arena_scope(const std::shared_ptr<monero_arena>& arena) : m_previous(monero_arena::s_current) { monero_arena::s_current = arena; }
+  ~monero_arena_scope() { monero_arena::s_current = m_previous; }
+  monero_arena_scope(const monero_arena_scope&) = delete;
+  monero_arena_scope& operator=(const monero_arena_scope&) = delete;
+
+private:
+  std::shared_ptr<monero_arena> m_previous;
+};
+
+/**
+ * Allocator which keeps its arena alive, so objects allocated with std::allocate_shared own their memory.
+ */
+template<class T>
+struct monero_arena_allocator {
+  using value_type = T;
+
+  std::shared_ptr<monero_arena> m_arena;
+
+  explicit monero_arena_allocator(std::shared_ptr<monero_arena> arena) : m_arena(std::move(arena)) { }
+
+  template<class U>
+  monero_arena_allocator(const monero_arena_allocator<U>& other) : m_arena(other.m_arena) { }
+
+  T* allocate(size_t n) { return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T))); }
+  void deallocate(T* /* ptr */, size_t /* n */) { }
+
+  template<class U>
+  bool operator==(const monero_arena_allocator<U>& other) const { return m_arena == other.m_arena; }
+
+  template<class U>
+  bool operator!=(const monero_arena_allocator<U>& other) const { return m_arena != other.m_arena; }
+};
+
+/**
+ * Make a shared object in the current arena, or on the heap if no arena is current.
+ */
+template<class T>
+std::shared_ptr<T> make_arena_shared() {
+  auto arena = monero_arena::get_current();
+  if (arena == nullptr) return std::make_shared<T>();
+  return std::allocate_shared<T>(monero_arena_allocator<T>(arena));
+}
+
+thread_local std::shared_ptr<monero_arena> monero_arena::s_current;
+
+void* monero_arena::allocate(size_t size, size_t alignment) {
+  void* ptr = m_next;
+  if (m_next == nullptr || std::align(alignment, size, ptr, m_available) == nullptr) {
+    // objects larger than a chunk get a chunk of their own
+    size_t chunk_size = std::max(m_chunk_size, size + alignment);
+    m_chunks.emplace_back(new char[chunk_size]);
+    ptr = m_chunks.back().get();
+    m_available = chunk_size;
+    if (std::align(alignment, size, ptr, m_available) == nullptr) throw std::bad_alloc();
+  }
+  m_next = static_cast<char*>(ptr) + size;
+  m_available -= size;
+  return ptr;
+}
+
+}
+
+/**
+ * Rebuilds model graphs from json written by serializable_struct::to_rapidjson_val().
+ *
+ * Backlinks which are not serialized (tx to block, output and transfer to tx) are
+ * restored from the nesting of the json. Standalone txs and transfers are read from
+ * the json written by PyMoneroWalletUtils::serialize_txs() and serialize_transfers(),
+ * which adds the block header of each tx and the type of each transfer.
+ */
+class monero_model_reader {
+public:
+  static rapidjson::Document parse_array(const std::string& json) {
+    rapidjson::Document doc;
+    doc.Parse(json.data(), json.size());
+    if (doc.HasParseError()) throw std::runtime_error("Invalid json");
+    if (!doc.IsArray()) throw std::runtime_error("Expected json array");
+    return doc;
+  }
+
+  static std::shared_ptr<monero_block> read_block(const rapidjson::Value& node) {
+    auto block = make_arena_shared<monero_block>();
+    read(node, "hash", block->m_hash);
+    read(node, "height", block->m_height);
+    read(node, "timestamp", block->m_timestamp);
+    read(node, "size", block->m_size);
+    read(node, "weight", block->m_weight);
+    read(node, "longTermWeight", block->m_long_term_weight);
+    read(node, "depth", block->m_depth);
+    read(node, "difficultyHigh", block->m_difficulty_high);
+    read(node, "difficultyLow", block->m_difficulty_low);
+    read(node, "cumulativeDifficultyHigh", block->m_cumulative_difficulty_high);
+    read(node, "cumulativeDifficultyLow", block->m_cumulative_difficulty_low);
+    read(node, "majorVersion", block->m_major_version);
+    read(node, "minorVersion", block->m_minor_version);
+    read(node, "nonce", block->m_nonce);
+    read(node, "minerTxHash", block->m_miner_tx_hash);
+    read(node, "numTxs", block->m_num_txs);
+    read(node, "orphanStatus", block->m_orphan_status);
+    read(node, "prevHash", block->m_prev_hash);
+    read(node, "reward", block->m_reward);
+    read(node, "powHash", block->m_pow_hash);
+    read(node, "hex", block->m_hex);
+    read(node, "txHashes", block->m_tx_hashes);
+    auto miner_tx = node.FindMember("minerTx");
+    if (miner_tx != node.MemberEnd() && miner_tx->value.IsObject()) {
+      auto tx = read_tx(miner_tx->value, is_tx_wallet(miner_tx->value));
+      tx->m_block = block;
+      block->m_miner_tx = tx;
+    }
+    auto txs = node.FindMember("txs");
+    if (txs != node.MemberEnd() && txs->value.IsArray()) {
+      block->m_txs.reserve(txs->value.Size());
+      for (const auto& tx_node : txs->value.GetArray()) {
+        auto tx = read_tx(tx_node, is_tx_wallet(tx_node));
+        tx->m_block = block;
+        block->m_txs.push_back(tx);
+      }
+    }
+    return block;
+  }
+
+  static std::shared_ptr<monero_tx> read_tx(const rapidjson::Value& node, bool is_wallet) {
+    if (!node.IsObject()) throw std::runtime_error("Expected json object for tx");
+    std::shared_ptr<monero_tx> tx;
+    std::shared_ptr<monero_tx_wallet> tx_wallet;
+    if (is_wallet) tx = tx_wallet = make_arena_shared<monero_tx_wallet>();
+    else tx = make_arena_shared<monero_tx>();
+    read(node, "hash", tx->m_hash);
+    read(node, "version", tx->m_version);
+    read(node, "isMinerTx", tx->m_is_miner_tx);
+    read(node, "paymentId", tx->m_payment_id);
+    read(node, "fee", tx->m_fee);
+    read(node, "ringSize", tx->m_ring_size);
+    read(node, "relay", tx->m_relay);
+    read(node, "isRelayed", tx->m_is_relayed);
+    read(node, "isConfirmed", tx->m_is_confirmed);
+    read(node, "inTxPool", tx->m_in_tx_pool);
+    read(node, "numConfirmations", tx->m_num_confirmations);
+    read(node, "unlockTime", tx->m_unlock_time);
+    read(node, "lastRelayedTimestamp", tx->m_last_relayed_timestamp);
+    read(node, "receivedTimestamp", tx->m_received_timestamp);
+    read(node, "isDoubleSpendSeen", tx->m_is_double_spend_seen);
+    read(node, "key", tx->m_key);
+    read(node, "fullHex", tx->m_full_hex);
+    read(node, "prunedHex", tx->m_pruned_hex);
+    read(node, "prunableHex", tx->m_prunable_hex);
+    read(node, "prunableHash", tx->m_prunable_hash);
+    read(node, "size", tx->m_size);
+    read(node, "weight", tx->m_weight);
+    read(node, "outputIndices", tx->m_output_indices);
+    read(node, "metadata", tx->m_metadata);
+    read(node, "commonTxSets", tx->m_common_tx_sets);
+    read(node, "extra", tx->m_extra);
+    read(node, "isKeptByBlock", tx->m_is_kept_by_block);
+    read(node, "isFailed", tx->m_is_failed);
+    read(node, "lastFailedHeight", tx->m_last_failed_height);
+    read(node, "lastFailedHash", tx->m_last_failed_hash);
+    read(node, "maxUsedBlockHeight", tx->m_max_used_block_height);
+    read(node, "maxUsedBlockHash", tx->m_max_used_block_hash);
+    read(node, "signatures", tx->m_signatures);
+    auto inputs = node.FindMember("inputs");
+    if (inputs != node.MemberEnd() && inputs->value.IsArray()) {
+      for (const auto& output_node : inputs->value.GetArray()) {
+        auto input = read_output(output_node, is_wallet);
+        input->m_tx = tx;
+        tx->m_inputs.push_back(input);
+      }
+    }
+    auto outputs = node.FindMember("outputs");
+    if (outputs != node.MemberEnd() && outputs->value.IsArray()) {
+      for (const auto& output_node : outputs->value.GetArray()) {
+        auto output = read_output(output_node, is_wallet);
+        output->m_tx = tx;
+        tx->m_outputs.push_back(output);
+      }
+    }
+    if (tx_wallet == nullptr) return tx;
+
+    read(node, "isIncoming", tx_wallet->m_is_incoming);
+    read(node, "isOutgoing", tx_wallet->m_is_outgoing);
+    read(node, "note", tx_wallet->m_note);
+    read(node, "isLocked", tx_wallet->m_is_locked);
+    read(node, "inputSum", tx_wallet->m_input_sum);
+    read(node, "outputSum", tx_wallet->m_output_sum);
+    read(node, "changeAddress", tx_wallet->m_change_address);
+    read(node, "changeAmount", tx_wallet->m_change_amount);
+    read(node, "numDummyOutputs", tx_wallet->m_num_dummy_outputs);
+    read(node, "extraHex", tx_wallet->m_extra_hex);
+    auto incoming_transfers = node.FindMember("incomingTransfers");
+    if (incoming_transfers != node.MemberEnd() && incoming_transfers->value.IsArray()) {
+      for (const auto& transfer_node : incoming_transfers->value.GetArray()) {
+        auto transfer = read_incoming_transfer(transfer_node);
+        transfer->m_tx = tx_wallet;
+        tx_wallet->m_incoming_transfers.push_back(transfer);
+      }
+    }
+    auto outgoing_transfer = node.FindMember("outgoingTransfer");
+    if (outgoing_transfer != node.MemberEnd() && outgoing_transfer->value.IsObject()) {
+      auto transfer = read_outgoing_transfer(outgoing_transfer->value);
+      transfer->m_tx = tx_wallet;
+      tx_wallet->m_outgoing_transfer = transfer;
+    }
+    return tx;
+  }
+
+  static std::shared_ptr<monero_output> read_output(const rapidjson::Value& node, bool is_wallet) {
+    if (!node.IsObject()) throw std::runtime_error("Expected json object for output");
+    std::shared_ptr<monero_output> output;
+    std::shared_ptr<monero_output_wallet> output_wallet;
+    if (is_wallet) output = output_wallet = make_arena_shared<monero_output_wallet>();
+    else output = make_arena_shared<monero_output>();
+    read(node, "amount", output->m_amount);
+    read(node, "index", output->m_index);
+    read(node, "stealthPublicKey", output->m_stealth_public_key);
+    read(node, "ringOutputIndices", output->m_ring_output_indices);
+    auto key_image = node.FindMember("keyImage");
+    if (key_image != node.MemberEnd() && key_image->value.IsObject()) {
+      output->m_key_image = make_arena_shared<monero_key_image>();
+      read(key_image->value, "hex", output->m_key_image->m_hex);
+      read(key_image->value, "signature", output->m_key_image->m_signature);
+    }
+    if (output_wallet == nullptr) return output;
+
+    read(node, "accountIndex", output_wallet->m_account_index);
+    read(node, "subaddressIndex", output_wallet->m_subaddress_index);
+    read(node, "isSpent", output_wallet->m_is_spent);
+    read(node, "isFrozen", output_wallet->m_is_frozen);
+    return output;
+  }
+
+  static std::shared_ptr<monero_transfer> read_transfer(const rapidjson::Value& node) {
+    if (!node.IsObject()) throw std::runtime_error("Expected json object for transfer");
+    boost::optional<std::string> type;
+    read(node, TRANSFER_TYPE_KEY, type);
+    if (type == std::string(TRANSFER_TYPE_INCOMING)) return read_incoming_transfer(node);
+    if (type == std::string(TRANSFER_TYPE_OUTGOING)) return read_outgoing_transfer(node);
+    throw std::runtime_error("Missing or invalid transfer type");
+  }
+
+  static std::shared_ptr<monero_incoming_transfer> read_incoming_transfer(const rapidjson::Value& node) {
+    auto transfer = make_arena_shared<monero_incoming_transfer>();
+    read(node, "amount", transfer->m_amount);
+    read(node, "accountIndex", transfer->m_account_index);
+    read(node, "address", transfer->m_address);
+    read(node, "subaddressIndex", transfer->m_subaddress_index);
+    read(node, "numSuggestedConfirmations", transfer->m_num_suggested_confirmations);
+    return transfer;
+  }
+
+  static std::shared_ptr<monero_outgoing_transfer> read_outgoing_transfer(const rapidjson::Value& node) {
+    auto transfer = make_arena_shared<monero_outgoing_transfer>();
+    read(node, "amount", transfer->m_amount);
+    read(node, "accountIndex", transfer->m_account_index);
+    read(node, "subaddressIndices", transfer->m_subaddress_indices);
+    read(node, "addresses", transfer->m_addresses);
+    auto destinations = node.FindMember("destinations");
+    if (destinations != node.MemberEnd() && destinations->value.IsArray()) {
+      for (const auto& destination_node : destinations->value.GetArray()) {
+        auto destination = make_arena_shared<monero_destination>();
+        read(destination_node, "address", destination->m_address);
+        read(destination_node, "amount", destination->m_amount);
+        transfer->m_destinations.push_back(destination);
+      }
+    }
+    return transfer;
+  }
+
+  static constexpr const char* TX_BLOCK_KEY = "block";
+  static constexpr const char* TRANSFER_TYPE_KEY = "type";
+  static constexpr const char* TRANSFER_TYPE_INCOMING = "incoming";
+  static constexpr const char* TRANSFER_TYPE_OUTGOING = "outgoing";
+
+  /**
+   * Link a standalone tx to the block header serialized with it, sharing blocks by hash.
+   */
+  static void read_tx_block(const rapidjson::Value& node, const std::shared_ptr<monero_tx>& tx, std::unordered_map<std::string, std::shared_ptr<monero_block>>& blocks) {
+    auto block_node = node.FindMember(TX_BLOCK_KEY);
+    if (block_node == node.MemberEnd() || !block_node->value.IsObject()) return;
+    boost::optional<std::string> hash;
+    read(block_node->value, "hash", hash);
+    std::shared_ptr<monero_block> block;
+    if (hash != boost::none) {
+      auto it = blocks.find(hash.get());
+      if (it != blocks.end()) block = it->second;
+    }
+    if (block == nullptr) {
+      block = read_block(block_node->value);
+      if (hash != boost::none) blocks[hash.get()] = block;
+    }
+    tx->m_block = block;
+    block->m_txs.push_back(tx);
+  }
+
+  static bool is_tx_wallet(const rapidjson::Value& node) {
+    return node.IsObject() && (node.HasMember("isIncoming") || node.HasMember("isOutgoing") || node.HasMember("incomingTransfers") || node.HasMember("outgoingTransfer") || node.HasMember("isLocked"));
+  }
+
+private:
+  template<class T>
+  static void read(const rapidjson::Value& node, const char* key, boost::optional<T>& field) {
+    auto member = node.FindMember(key);
+    if (member == node.MemberEnd() || member->value.IsNull()) return;
+    field = read_value<T>(member->value, key);
+  }
+
+  template<class T>
+  static void read(const rapidjson::Value& node, const char* key, std::vector<T>& field) {
+    auto member = node.FindMember(key);
+    if (member == node.MemberEnd() || !member->value.IsArray()) return;
+    field.clear();
+    field.reserve(member->value.Size());
+    for (const auto& value : member->value.GetArray()) field.push_back(read_value<T>(value, key));
+  }
+
+  template<class T>
+  static T read_value(const rapidjson::Value& value, const char* key) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      if (value.IsString()) return std::string(value.GetString(), value.GetStringLength());
+    } else if constexpr (std::is_same<T, bool>::value) {
+      if (value.IsBool()) return value.GetBool();
+    } else if constexpr (std::is_integral<T>::value) {
+      if (value.IsUint64()) return static_cast<T>(value.GetUint64());
+      if (value.IsInt64()) return static_cast<T>(value.GetInt64());
+    }
+    throw std::runtime_error(std::string("Invalid json value for ") + key);
+  }
+};
+
+std::vector<std::shared_ptr<monero_block>> PyMoneroWalletUtils::deserialize_blocks(const std::string& json, bool use_arena) {
+  rapidjson::Document doc = monero_model_reader::parse_array(json);
+  monero_arena_scope scope(use_arena ? std::make_shared<monero_arena>() : nullptr);
+  std::vector<std::shared_ptr<monero_block>> blocks;
+  blocks.reserve(doc.Size());
+  for (const auto& node : doc.GetArray()) blocks.push_back(node.IsNull() ? nullptr : monero_model_reader::read_block(node));
+  return blocks;
+}
+
+std::string PyMoneroWalletUtils::serialize_txs(const std::vector<std::shared_ptr<monero_tx_wallet>>& txs) {
+  // txs do not serialize their block, so its header is added to restore the tx height
+  return PyGenUtils::serialize_many(txs, [](const monero_tx_wallet& tx, rapidjson::Document::AllocatorType& allocator) {
+    rapidjson::Value value = tx.to_rapidjson_val(allocator);
+    if (tx.m_block != nullptr) {
+      rapidjson::Value header = tx.m_block->monero_block_header::to_rapidjson_val(allocator);
+      value.AddMember(rapidjson::StringRef(monero_model_reader::TX_BLOCK_KEY), header, allocator);
+    }
+    return value;
+  });
+}
+
+std::string PyMoneroWalletUtils::serialize_transfers(const std::vector<std::shared_ptr<monero_transfer>>& transfers) {
+  return PyGenUtils::serialize_many(transfers, [](const monero_transfer& transfer, rapidjson::Document::AllocatorType& allocator) {
+    rapidjson::Value value = transfer.to_rapidjson_val(allocator);
+    const char* type = dynamic_cast<const monero_incoming_transfer*>(&transfer) != nullptr ? monero_model_reader::TRANSFER_TYPE_INCOMING : monero_model_reader::TRANSFER_TYPE_OUTGOING;
+    value.AddMember(rapidjson::StringRef(monero_model_reader::TRANSFER_TYPE_KEY), rapidjson::StringRef(type), allocator);
+    return value;
+  });
+}
+
+std::vector<std::shared_ptr<monero_tx_wallet>> PyMoneroWalletUtils::deserialize_txs(const std::string& json, bool use_arena) {
+  rapidjson::Document doc = monero_model_reader::parse_array(json);
+  monero_arena_scope scope(use_arena ? std::make_shared<monero_arena>() : nullptr);
+  std::vector<std::shared_ptr<monero_tx_wallet>> txs;
+  txs.reserve(doc.Size());
+  std::unordered_map<std::string, std::shared_ptr<monero_block>> blocks;
+  for (const auto& node : doc.GetArray()) {
+    if (node.IsNull()) {
+      txs.push_back(nullptr);
+      continue;
+    }
+    auto tx = std::static_pointer_cast<monero_tx_wallet>(monero_model_reader::read_tx(node, true));
+    monero_model_reader::read_tx_block(node, tx, blocks);
+    txs.push_back(tx);
+  }
+  return txs;
+}
+
+std::vector<std::shared_ptr<monero_transfer>> PyMoneroWalletUtils::deserialize_transfers(const std::string& json, bool use_arena) {
+  rapidjson::Document doc = monero_model_reader::parse_array(json);
+  monero_arena_scope scope(use_arena ? std::make_shared<monero_arena>() : nullptr);
+  std::vector<std::shared_ptr<monero_transfer>> transfers;
+  transfers.reserve(doc.Size());
+  for (const auto& node : doc.GetArray()) transfers.push_back(node.IsNull() ? nullptr : monero_model_reader::read_transfer(node));
+  return transfers;
+}
+
+std::vector<std::shared_ptr<monero_output_wallet>> PyMoneroWalletUtils::deserialize_outputs(const std::string& json, bool use_arena) {
+  rapidjson::Document doc = monero_model_reader::parse_array(json);
+  monero_arena_scope scope(use_arena ? std::make_shared<monero_arena>() : nullptr);
+  std::vector<std::shared_ptr<monero_output_wallet>> outputs;
+  outputs.reserve(doc.Size());
+  for (const auto& node : doc.GetArray()) outputs.push_back(node.IsNull() ? nullptr : std::static_pointer_cast<monero_output_wallet>(monero_model_reader::read_output(node, true)));
+  return outputs;
+}
+
+// --------------------------- GRAPH SERIALIZATION ---------------------------
+
+/**
+ * Locates objects of a tx graph relative to the root they are serialized with.
+ */
+class monero_graph_locator {
+public:
+  enum kind : int { ROOT = 0, TX = 1, INPUT = 2, OUTPUT = 3, INCOMING_TRANSFER = 4, OUTGOING_TRANSFER = 5 };
+
+  static constexpr int MINER_TX_IDX = -1;
+
+  template<class T>
+  static std::shared_ptr<T> get_ptr(const std::shared_ptr<T>& ptr) { return ptr; }
+
+  template<class T>
+  static std::shared_ptr<T> get_ptr(const boost::optional<std::shared_ptr<T>>& ptr) { return ptr == boost::none ? nullptr : ptr.get(); }
+
+  template<class T, class U>
+  static int index_of(const std::vector<std::shared_ptr<T>>& items, const U* item) {
+    for (size_t i = 0; i < items.size(); i++) {
+      if (items[i].get() == item) return static_cast<int>(i);
+    }
+    return -1;
+  }
+
+  static const char* get_root_type(const std::shared_ptr<serializable_struct>& root) {
+    if (std::dynamic_pointer_cast<monero_block>(root) != nullptr) return "block";
+    if (std::dynamic_pointer_cast<monero_tx_wallet>(root) != nullptr) return "txWallet";
+    if (std::dynamic_pointer_cast<monero_tx>(root) != nullptr) return "tx";
+    if (std::dynamic_pointer_cast<monero_output_wallet>(root) != nullptr) return "outputWallet";
+    if (std::dynamic_pointer_cast<monero_output>(root) != nullptr) return "output";
+    if (std::dynamic_pointer_cast<monero_incoming_transfer>(root) != nullptr) return "incomingTransfer";
+    if (std::dynamic_pointer_cast<monero_outgoing_transfer>(root) != nullptr) return "outgoingTransfer";
+    throw std::runtime_error("Unsupported type for graph serialization");
+  }
+
+  /**
+   * Resolve the root of an object's graph and the object's position under it.
+   */
+  static std::shared_ptr<serializable_struct> locate(const std::shared_ptr<serializable_struct>& object, int& tx_idx, int& kind, int& idx) {
+    tx_idx = 0;
+    kind = ROOT;
+    idx = 0;
+    std::shared_ptr<monero_tx> tx;
+    if (auto transfer = std::dynamic_pointer_cast<monero_transfer>(object)) {
+      tx = get_ptr(transfer->m_tx);
+      auto tx_wallet = std::dynamic_pointer_cast<monero_tx_wallet>(tx);
+      if (tx_wallet == nullptr) return object;
+      if (tx_wallet->m_outgoing_transfer.get() == transfer.get()) kind = OUTGOING_TRANSFER;
+      else if ((idx = index_of(tx_wallet->m_incoming_transfers, transfer.get())) >= 0) kind = INCOMING_TRANSFER;
+      else return object;
+    }
+    else if (auto output = std::dynamic_pointer_cast<monero_output>(object)) {
+      tx = get_ptr(output->m_tx);
+      if (tx == nullptr) return object;
+      if ((idx = index_of(tx->m_outputs, output.get())) >= 0) kind = OUTPUT;
+      else if ((idx = index_of(tx->m_inputs, output.get())) >= 0) kind = INPUT;
+      else return object;
+    }
+    else if (std::dynamic_pointer_cast<monero_block>(object) != nullptr) return object;
+    else if (auto object_tx = std::dynamic_pointer_cast<monero_tx>(object)) {
+      tx = object_tx;
+      kind = TX;
+    }
+    else throw std::runtime_error("Unsupported type for graph serialization");
+
+    // locate the tx in its block
+    auto block = get_ptr(tx->m_block);
+    if (block != nullptr) {
+      if (get_ptr(block->m_miner_tx).get() == tx.get()) {
+        tx_idx = MINER_TX_IDX;
+        return block;
+      }
+      tx_idx = index_of(block->m_txs, tx.get());
+      if (tx_idx >= 0) return block;
+      tx_idx = 0;
+    }
+    if (kind == TX) kind = ROOT;
+    return tx;
+  }
+
+  /**
+   * Resolve an object from its root and position.
+   */
+  static std::shared_ptr<serializable_struct> resolve(const std::shared_ptr<serializable_struct>& root, int tx_idx, int kind, int idx) {
+    if (kind == ROOT) return root;
+    std::shared_ptr<monero_tx> tx;
+    if (auto block = std::dynamic_pointer_cast<monero_block>(root)) {
+      if (tx_idx == MINER_TX_IDX) tx = get_ptr(block->m_miner_tx);
+      else if (tx_idx >= 0 && static_cast<size_t>(tx_idx) < block->m_txs.size()) tx = block->m_txs[tx_idx];
+    }
+    else tx = std::dynamic_pointer_cast<monero_tx>(root);
+    if (tx == nullptr) throw std::runtime_error("Invalid graph reference");
+    if (kind == TX) return tx;
+    if (kind == INPUT && idx >= 0 && static_cast<size_t>(idx) < tx->m_inputs.size()) return tx->m_inputs[idx];
+    if (kind == OUTPUT && idx >= 0 && static_cast<size_t>(idx) < tx->m_outputs.size()) return tx->m_outputs[idx];
+    auto tx_wallet = std::dynamic_pointer_cast<monero_tx_wallet>(tx);
+    if (tx_wallet != nullptr && kind == OUTGOING_TRANSFER && tx_wallet->m_outgoing_transfer != nullptr) return tx_wallet->m_outgoing_transfer;
+    if (tx_wallet != nullptr && kind == INCOMING_TRANSFER && idx >= 0 && static_cast<size_t>(idx) < tx_wallet->m_incoming_transfers.size()) return tx_wallet->m_incoming_transfers[idx];
+    throw std::runtime_error("Invalid graph reference");
+  }
+};
+
+std::string PyMoneroWalletUtils::serialize_graph(const std::vector<std::shared_ptr<serializable_struct>>& objects) {
+  rapidjson::Document doc;
+  doc.SetObject();
+  auto& allocator = doc.GetAllocator();
+  rapidjson::Value roots(rapidjson::kArrayType);
+  rapidjson::Value refs(rapidjson::kArrayType);
+
+  // each root is written once so objects sharing a graph keep sharing it
+  std::unordered_map<const serializable_struct*, int> root_indices;
+  for (const auto& object : objects) {
+    if (object == nullptr) {
+      refs.PushBack(rapidjson::Value(rapidjson::kNullType), allocator);
+      continue;
+    }
+    int tx_idx, kind, idx;
+    auto root = monero_graph_locator::locate(object, tx_idx, kind, idx);
+    auto root_idx = root_indices.find(root.get());
+    if (root_idx == root_indices.end()) {
+      rapidjson::Value root_node(rapidjson::kObjectType);
+      root_node.AddMember("type", rapidjson::StringRef(monero_graph_locator::get_root_type(root)), allocator);
+      root_node.AddMember("value", root->to_rapidjson_val(allocator), allocator);
+      roots.PushBack(root_node, allocator);
+      root_idx = root_indices.emplace(root.get(), static_cast<int>(roots.Size()) - 1).first;
+    }
+    rapidjson::Value ref(rapidjson::kArrayType);
+    ref.PushBack(root_idx->second, allocator).PushBack(tx_idx, allocator).PushBack(kind, allocator).PushBack(idx, allocator);
+    refs.PushBack(ref, allocator);
+  }
+  doc.AddMember("roots", roots, allocator);
+  doc.AddMember("refs", refs, allocator);
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  doc.Accept(writer);
+  return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+std::vector<std::shared_ptr<serializable_struct>> PyMoneroWalletUtils::deserialize_graph(const std::string& data) {
+  rapidjson::Document doc;
+  doc.Parse(data.data(), data.size());
+  if (doc.HasParseError() || !doc.IsObject()) throw std::runtime_error("Invalid graph data");
+  auto roots_node = doc.FindMember("roots");
+  auto refs_node = doc.FindMember("refs");
+  if (roots_node == doc.MemberEnd() || !roots_node->value.IsArray() || refs_node == doc.MemberEnd() || !refs_node->value.IsArray()) throw std::runtime_error("Invalid graph data");
+
+  std::vector<std::shared_ptr<serializable_struct>> roots;
+  roots.reserve(roots_node->value.Size());
+  for (const auto& root_node : roots_node->value.GetArray()) {
+    if (!root_node.IsObject() || !root_node.HasMember("type") || !root_node["type"].IsString() || !root_node.HasMember("value")) throw std::runtime_error("Invalid graph data");
+    std::string type = root_node["type"].GetString();
+    const rapidjson::Value& value = root_node["value"];
+    if (type == "block") roots.push_back(monero_model_reader::read_block(value));
+    else if (type == "txWallet") roots.push_back(monero_model_reader::read_tx(value, true));
+    else if (type == "tx") roots.push_back(monero_model_reader::read_tx(value, false));
+    else if (type == "outputWallet") roots.push_back(monero_model_reader::read_output(value, true));
+    else if (type == "output") roots.push_back(monero_model_reader::read_output(value, false));
+    else if (type == "incomingTransfer") roots.push_back(monero_model_reader::read_incoming_transfer(value));
+    else if (type == "outgoingTransfer") roots.push_back(monero_model_reader::read_outgoing_transfer(value));
+    else throw std::runtime_error("Invalid graph root type: " + type);
+  }
+
+  std::vector<std::shared_ptr<serializable_struct>> objects;
+  objects.reserve(refs_node->value.Size());
+  for (const auto& ref : refs_node->value.GetArray()) {
+    if (ref.IsNull()) {
+      objects.push_back(nullptr);
+      continue;
+    }
+    if (!ref.IsArray() || ref.Size() != 4 || !ref[0].IsInt() || !ref[1].IsInt() || !ref[2].IsInt() || !ref[3].IsInt()) throw std::runtime_error("Invalid graph reference");
+    int root_idx = ref[0].GetInt();
+    if (root_idx < 0 || static_cast<size_t>(root_idx) >= roots.size()) throw std::runtime_error("Invalid graph reference");
+    objects.push_back(monero_graph_locator::resolve(roots[root_idx], ref[1].GetInt(), ref[2].GetInt(), ref[3].GetInt()));
+  }
+  return objects;
+}
+
+// --------------------------- MODEL COLUMNS ---------------------------
+
+namespace {
+
+template<class T>
+struct monero_model_column {
+  std::function<py::object(const std::shared_ptr<T>&)> m_get_object;
+  std::function<boost::optional<uint64_t>(const std::shared_ptr<T>&)> m_get_uint64; // empty if the field is not an integer or bool
+  std::function<int(const std::shared_ptr<T>&, const std::shared_ptr<T>&, bool)> m_compare;
+};
+
+template<class T>
+using monero_model_column_table = std::map<std::string, monero_model_column<T>>;
+
+template<class V> struct is_integral_column : std::is_integral<V> {};
+template<class V> struct is_integral_column<boost::optional<V>> : std::is_integral<V> {};
+
+template<class V>
+boost::optional<uint64_t> to_uint64(const V& value) { return static_cast<uint64_t>(value); }
+
+template<class V>
+boost::optional<uint64_t> to_uint64(const boost::optional<V>& value) {
+  if (value == boost::none) return boost::none;
+  return static_cast<uint64_t>(value.get());
+}
+
+template<class V>
+int compare_column_values(const V& a, const V& b, bool descending) {
+  int result = a < b ? -1 : (b < a ? 1 : 0);
+  return descending ? -result : result;
+}
+
+// unset values order after set values in both directions
+template<class V>
+int compare_column_values(const boost::optional<V>& a, const boost::optional<V>& b, bool descending) {
+  if (a == boost::none) return b == boost::none ? 0 : 1;
+  if (b == boost::none) return -1;
+  return compare_column_values(a.get(), b.get(), descending);
+}
+
+template<class P>
+std::shared_ptr<P> column_ptr(const std::shared_ptr<P>& ptr) { return ptr; }
+
+template<class P>
+std::shared_ptr<P> column_ptr(const boost::optional<std::shared_ptr<P>>& ptr) { return ptr == boost::none ? nullptr : ptr.get(); }
+
+template<class T, class F>
+void add_column(monero_model_column_table<T>& table, const std::string& name, F getter) {
+  using V = std::decay_t<decltype(getter(std::declval<const std::shared_ptr<T>&>()))>;
+  monero_model_column<T> column;
+  column.m_get_object = [getter](const std::shared_ptr<T>& object) { return py::cast(getter(object)); };
+  if constexpr (is_integral_column<V>::value) {
+    column.m_get_uint64 = [getter](const std::shared_ptr<T>& object) { return to_uint64(getter(object)); };
+  }
+  column.m_compare = [getter](const std::shared_ptr<T>& a, const std::shared_ptr<T>& b, bool descending) { return compare_column_values(getter(a), getter(b), descending); };
+  table[name] = std::move(column);
+}
+
+template<class T, class M>
+void add_member_column(monero_model_column_table<T>& table, const std::string& name, M member) {
+  add_column(table, name, [member](const std::shared_ptr<T>& object) -> const auto& { return (*object).*member; });
+}
+
+template<class T>
+void add_block_header_columns(monero_model_column_table<T>& table) {
+  add_member_column(table, "hash", &monero_block_header::m_hash);
+  add_member_column(table, "height", &monero_block_header::m_height);
+  add_member_column(table, "timestamp", &monero_block_header::m_timestamp);
+  add_member_column(table, "size", &monero_block_header::m_size);
+  add_member_column(table, "weight", &monero_block_header::m_weight);
+  add_member_column(table, "long_term_weight", &monero_block_header::m_long_term_weight);
+  add_member_column(table, "depth", &monero_block_header::m_depth);
+  add_member_column(table, "difficulty_high", &monero_block_header::m_difficulty_high);
+  add_member_column(table, "difficulty_low", &monero_block_header::m_difficulty_low);
+  add_member_column(table, "cumulative_difficulty_high", &monero_block_header::m_cumulative_difficulty_high);
+  add_member_column(table, "cumulative_difficulty_low", &monero_block_header::m_cumulative_difficulty_low);
+  add_member_column(table, "major_version", &monero_block_header::m_major_version);
+  add_member_column(table, "minor_version", &monero_block_header::m_minor_version);
+  add_member_column(table, "nonce", &monero_block_header::m_nonce);
+  add_member_column(table, "miner_tx_hash", &monero_block_header::m_miner_tx_hash);
+  add_member_column(table, "num_txs", &monero_block_header::m_num_txs);
+  add_member_column(table, "orphan_status", &monero_block_header::m_orphan_status);
+  add_member_column(table, "prev_hash", &monero_block_header::m_prev_hash);
+  add_member_column(table, "reward", &monero_block_header::m_reward);
+  add_member_column(table, "pow_hash", &monero_block_header::m_pow_hash);
+}
+
+template<class T>
+void add_tx_columns(monero_model_column_table<T>& table) {
+  add_member_column(table, "hash", &monero_tx::m_hash);
+  add_member_column(table, "version", &monero_tx::m_version);
+  add_member_column(table, "is_miner_tx", &monero_tx::m_is_miner_tx);
+  add_member_column(table, "payment_id", &monero_tx::m_payment_id);
+  add_member_column(table, "fee", &monero_tx::m_fee);
+  add_member_column(table, "ring_size", &monero_tx::m_ring_size);
+  add_member_column(table, "relay", &monero_tx::m_relay);
+  add_member_column(table, "is_relayed", &monero_tx::m_is_relayed);
+  add_member_column(table, "is_confirmed", &monero_tx::m_is_confirmed);
+  add_member_column(table, "in_tx_pool", &monero_tx::m_in_tx_pool);
+  add_member_column(table, "num_confirmations", &monero_tx::m_num_confirmations);
+  add_member_column(table, "unlock_time", &monero_tx::m_unlock_time);
+  add_member_column(table, "last_relayed_timestamp", &monero_tx::m_last_relayed_timestamp);
+  add_member_column(table, "received_timestamp", &monero_tx::m_received_timestamp);
+  add_member_column(table, "is_double_spend_seen", &monero_tx::m_is_double_spend_seen);
+  add_member_column(table, "key", &monero_tx::m_key);
+  add_member_column(table, "full_hex", &monero_tx::m_full_hex);
+  add_member_column(table, "pruned_hex", &monero_tx::m_pruned_hex);
+  add_member_column(table, "prunable_hex", &monero_tx::m_prunable_hex);
+  add_member_column(table, "prunable_hash", &monero_tx::m_prunable_hash);
+  add_member_column(table, "size", &monero_tx::m_size);
+  add_member_column(table, "weight", &monero_tx::m_weight);
+  add_member_column(table, "metadata", &monero_tx::m_metadata);
+  add_member_column(table, "common_tx_sets", &monero_tx::m_common_tx_sets);
+  add_member_column(table, "rct_signatures", &monero_tx::m_rct_signatures);
+  add_member_column(table, "rct_sig_prunable", &monero_tx::m_rct_sig_prunable);
+  add_member_column(table, "is_kept_by_block", &monero_tx::m_is_kept_by_block);
+  add_member_column(table, "is_failed", &monero_tx::m_is_failed);
+  add_member_column(table, "last_failed_height", &monero_tx::m_last_failed_height);
+  add_member_column(table, "last_failed_hash", &monero_tx::m_last_failed_hash);
+  add_member_column(table, "max_used_block_height", &monero_tx::m_max_used_block_height);
+  add_member_column(table, "max_used_block_hash", &monero_tx::m_max_used_block_hash);
+  add_column(table, "height", [](const std::shared_ptr<T>& tx) { return tx->get_height(); });
+}
+
+template<class T>
+void add_tx_wallet_columns(monero_model_column_table<T>& table) {
+  add_tx_columns(table);
+  add_member_column(table, "is_incoming", &monero_tx_wallet::m_is_incoming);
+  add_member_column(table, "is_outgoing", &monero_tx_wallet::m_is_outgoing);
+  add_member_column(table, "note", &monero_tx_wallet::m_note);
+  add_member_column(table, "is_locked", &monero_tx_wallet::m_is_locked);
+  add_member_column(table, "input_sum", &monero_tx_wallet::m_input_sum);
+  add_member_column(table, "output_sum", &monero_tx_wallet::m_output_sum);
+  add_member_column(table, "change_address", &monero_tx_wallet::m_change_address);
+  add_member_column(table, "change_amount", &monero_tx_wallet::m_change_amount);
+  add_member_column(table, "num_dummy_outputs", &monero_tx_wallet::m_num_dummy_outputs);
+  add_member_column(table, "extra_hex", &monero_tx_wallet::m_extra_hex);
+}
+
+template<class T>
+void add_transfer_columns(monero_model_column_table<T>& table) {
+  add_member_column(table, "account_index", &monero_transfer::m_account_index);
+  add_member_column(table, "amount", &monero_transfer::m_amount);
+  add_column(table, "is_incoming", [](const std::shared_ptr<T>& transfer) -> boost::optional<bool> { return transfer->is_incoming(); });
+  add_column(table, "is_outgoing", [](const std::shared_ptr<T>& transfer) -> boost::optional<bool> { return transfer->is_outgoing(); });
+  add_column(table, "tx_hash", [](const std::shared_ptr<T>& transfer) {
+    auto tx = column_ptr(transfer->m_tx);
+    return tx == nullptr ? boost::optional<std::string>() : tx->m_hash;
+  });
+  add_column(table, "height", [](const std::shared_ptr<T>& transfer) {
+    auto tx = column_ptr(transfer->m_tx);
+    return tx == nullptr ? boost::optional<uint64_t>() : tx->get_height();
+  });
+
+  // incoming fields, unset for outgoing transfers
+  add_column(table, "address", [](const std::shared_ptr<T>& transfer) {
+    auto incoming = dynamic_cast<const monero_incoming_transfer*>(transfer.get());
+    return incoming == nullptr ? boost::optional<std::string>() : incoming->m_address;
+  });
+  add_column(table, "subaddress_index", [](const std::shared_ptr<T>& transfer) {
+    auto incoming = dynamic_cast<const monero_incoming_transfer*>(transfer.get());
+    return incoming == nullptr ? boost::optional<uint32_t>() : incoming->m_subaddress_index;
+  });
+  add_column(table, "num_suggested_confirmations", [](const std::shared_ptr<T>& transfer) {
+    auto incoming = dynamic_cast<const monero_incoming_transfer*>(transfer.get());
+    return incoming == nullptr ? boost::optional<uint64_t>() : incoming->m_num_suggested_confirmations;
+  });
+}
+
+template<class T>
+void add_output_columns(monero_model_column_table<T>& table) {
+  add_member_column(table, "amount", &monero_output::m_amount);
+  add_member_column(table, "index", &monero_output::m_index);
+  add_member_column(table, "stealth_public_key", &monero_output::m_stealth_public_key);
+  add_column(table, "key_image", [](const std::shared_ptr<T>& output) {
+    return output->m_key_image == nullptr ? boost::optional<std::string>() : output->m_key_image->m_hex;
+  });
+  add_column(table, "tx_hash", [](const std::shared_ptr<T>& output) {
+    auto tx = column_ptr(output->m_tx);
+    return tx == nullptr ? boost::optional<std::string>() : tx->m_hash;
+  });
+  add_column(table, "height", [](const std::shared_ptr<T>& output) {
+    auto tx = column_ptr(output->m_tx);
+    return tx == nullptr ? boost::optional<uint64_t>() : tx->get_height();
+  });
+}
+
+void add_columns(monero_model_column_table<monero_block_header>& table) { add_block_header_columns(table); }
+
+void add_columns(monero_model_column_table<monero_block>& table) {
+  add_block_header_columns(table);
+  add_member_column(table, "hex", &monero_block::m_hex);
+}
+
+void add_columns(monero_model_column_table<monero_tx>& table) { add_tx_columns(table); }
+
+void add_columns(monero_model_column_table<monero_tx_wallet>& table) { add_tx_wallet_columns(table); }
+
+void add_columns(monero_model_column_table<monero_transfer>& table) { add_transfer_columns(table); }
+
+void add_columns(monero_model_column_table<monero_incoming_transfer>& table) { add_transfer_columns(table); }
+
+void add_columns(monero_model_column_table<monero_outgoing_transfer>& table) { add_transfer_columns(table); }
+
+void add_columns(monero_model_column_table<monero_output>& table) { add_output_columns(table); }
+
+void add_columns(monero_model_column_table<monero_output_wallet>& table) {
+  add_output_columns(table);
+  add_member_column(table, "account_index", &monero_output_wallet::m_account_index);
+  add_member_column(table, "subaddress_index", &monero_output_wallet::m_subaddress_index);
+  add_member_column(table, "is_spent", &monero_output_wallet::m_is_spent);
+  add_member_column(table, "is_frozen", &monero_output_wallet::m_is_frozen);
+}
+
+template<class T>
+const monero_model_column<T>& get_model_column(const std::string& name) {
+  static const monero_model_column_table<T> table = [] {
+    monero_model_column_table<T> columns;
+    add_columns(columns);
+    return columns;
+  }();
+  auto it = table.find(name);
+  if (it == table.end()) throw std::runtime_error("Unknown column: " + name);
+  return it->second;
+}
+
+// vectors below this size are sorted on the calling thread
+constexpr size_t PARALLEL_SORT_THRESHOLD = 1 << 15;
+
+/**
+ * Stable sort of independently sorted chunks, merged pairwise in parallel rounds on the thread pool.
+ */
+template<class It, class Compare>
+void parallel_stable_sort(It begin, It end, Compare comp, uint32_t num_threads) {
+  PyMoneroThreadPool& pool = PyMoneroThreadPool::get_instance();
+  size_t size = static_cast<size_t>(end - begin);
+  size_t num_workers = num_threads == 0 ? pool.get_num_threads() + 1 : num_threads;
+  size_t num_chunks = std::min<size_t>(num_workers, size / (PARALLEL_SORT_THRESHOLD / 2));
+  if (num_chunks <= 1) {
+    std::stable_sort(begin, end, comp);
+    return;
+  }
+
+  std::vector<It> bounds;
+  for (size_t i = 0; i <= num_chunks; i++) bounds.push_back(begin + static_cast<std::ptrdiff_t>(size * i / num_chunks));
+
+  // chunks are claimed by pool workers, so a busy pool sorts them with fewer threads
+  std::atomic<size_t> next_chunk(0);
+  pool.parallel_for(num_chunks, [&](size_t /* worker_idx */) {
+    for (size_t i = next_chunk++; i < num_chunks; i = next_chunk++) std::stable_sort(bounds[i], bounds[i + 1], comp);
+  });
+
+  // merging only adjacent chunks keeps equal elements in their original order
+  for (size_t width = 1; width < num_chunks; width *= 2) {
+    size_t num_merges = (num_chunks - width + 2 * width - 1) / (2 * width);
+    std::atomic<size_t> next_merge(0);
+    pool.parallel_for(num_merges, [&](size_t /* worker_idx */) {
+      for (size_t j = next_merge++; j < num_merges; j = next_merge++) {
+        size_t i = j * 2 * width;
+        std::inplace_merge(bounds[i], bounds[i + width], bounds[std::min(i + 2 * width, num_chunks)], comp);
+      }
+    });
+  }
+}
+
+}
+
+template<class T>
+py::list PyMoneroWalletUtils::get_column(const std::vector<std::shared_ptr<T>>& objects, const std::string& name) {
+  const auto& column = get_model_column<T>(name);
+  py::list values(objects.size());
+  for (size_t i = 0; i < objects.size(); i++) {
+    if (objects[i] == nullptr) values[i] = py::none();
+    else values[i] = column.m_get_object(objects[i]);
+  }
+  return values;
+}
+
+template<class T>
+std::vector<uint64_t> PyMoneroWalletUtils::get_uint64_column(const std::vector<std::shared_ptr<T>>& objects, const std::string& name, uint64_t fill) {
+  const auto& column = get_model_column<T>(name);
+  if (!column.m_get_uint64) throw std::runtime_error("Column is not an integer or bool column: " + name);
+  std::vector<uint64_t> values(objects.size(), fill);
+  for (size_t i = 0; i < objects.size(); i++) {
+    if (objects[i] == nullptr) continue;
+    auto value = column.m_get_uint64(objects[i]);
+    if (value != boost::none) values[i] = value.get();
+  }
+  return values;
+}
+
+template<class T>
+void PyMoneroWalletUtils::sort_by(std::vector<std::shared_ptr<T>>& objects, const std::vector<std::string>& keys, uint32_t num_threads) {
+  if (keys.empty()) throw std::runtime_error("Must provide at least one sort key");
+
+  // a leading '-' sorts the key in descending order
+  std::vector<std::pair<const monero_model_column<T>*, bool>> columns;
+  for (const std::string& key : keys) {
+    bool descending = !key.empty() && key[0] == '-';
+    columns.emplace_back(&get_model_column<T>(descending ? key.substr(1) : key), descending);
+  }
+
+  // null objects order last
+  auto comp = [&columns](const std::shared_ptr<T>& a, const std::shared_ptr<T>& b) {
+    if (a == nullptr || b == nullptr) return a != nullptr;
+    for (const auto& column : columns) {
+      int result = column.first->m_compare(a, b, column.second);
+      if (result != 0) return result < 0;
+    }
+    return false;
+  };
+  parallel_stable_sort(objects.begin(), objects.end(), comp, num_threads);
+}
+
+template<class T>
+std::vector<std::string> PyMoneroWalletUtils::get_column_names() {
+  monero_model_column_table<T> table;
+  add_columns(table);
+  std::vector<std::string> names;
+  for (const auto& column : table) names.push_back(column.first);
+  return names;
+}
+
+#define MONERO_INSTANTIATE_COLUMNS(T) \
+  template py::list PyMoneroWalletUtils::get_column<T>(const std::vector<std::shared_ptr<T>>&, const std::string&); \
+  template std::vector<uint64_t> PyMoneroWalletUtils::get_uint64_column<T>(const std::vector<std::shared_ptr<T>>&, const std::string&, uint64_t); \
+  template void PyMoneroWalletUtils::sort_by<T>(std::vector<std::shared_ptr<T>>&, const std::vector<std::string>&, uint32_t); \
+  template std::vector<std::string> PyMoneroWalletUtils::get_column_names<T>();
+
+MONERO_INSTANTIATE_COLUMNS(monero_block_header)
+MONERO_INSTANTIATE_COLUMNS(monero_block)
+MONERO_INSTANTIATE_COLUMNS(monero_tx)
+MONERO_INSTANTIATE_COLUMNS(monero_tx_wallet)
+MONERO_INSTANTIATE_COLUMNS(monero_transfer)
+MONERO_INSTANTIATE_COLUMNS(monero_incoming_transfer)
+MONERO_INSTANTIATE_COLUMNS(monero_outgoing_transfer)
+MONERO_INSTANTIATE_COLUMNS(monero_output)
+MONERO_INSTANTIATE_COLUMNS(monero_output_wallet)
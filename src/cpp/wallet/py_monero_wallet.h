@@ -55,6 +55,8 @@
 
 #include <pybind11/stl_bind.h>
 #include <pybind11/eval.h>
+#include <unordered_map>
+#include <array>
 #include "common/py_monero_common.h"
 #include "wallet/monero_wallet.h"
 
@@ -91,6 +93,230 @@ public:
   }
 };
 
+/**
+ * Receives progress notifications from a partitioned scan.
+ */
+class monero_partition_scan_listener {
+public:
+  virtual ~monero_partition_scan_listener() = default;
+
+  /**
+   * Invoked when a partition makes progress.
+   *
+   * @param partition_idx is the index of the partition
+   * @param height is the last height scanned by the partition
+   * @param start_height is the first height of the partition
+   * @param end_height is the height the partition stops before
+   * @param blocks_per_second is the scan throughput of the partition
+   */
+  virtual void on_partition_progress(uint32_t partition_idx, uint64_t height, uint64_t start_height, uint64_t end_height, double blocks_per_second) { }
+};
+
+class PyMoneroPartitionScanListener : public monero_partition_scan_listener {
+public:
+  void on_partition_progress(uint32_t partition_idx, uint64_t height, uint64_t start_height, uint64_t end_height, double blocks_per_second) override {
+    PYBIND11_OVERRIDE(void, monero_partition_scan_listener, on_partition_progress, partition_idx, height, start_height, end_height, blocks_per_second);
+  }
+};
+
+/**
+ * Models the result of a partitioned scan.
+ *
+ * The scan is read-only: the result is a report of what each partition found and is never applied
+ * to the scanned wallet. Outgoing txs which spend outputs received in an earlier partition are not
+ * linked, so the tx history is incomplete; use a regular sync or rescan to restore a wallet.
+ */
+struct monero_partition_scan_result {
+  uint64_t m_start_height = 0;
+  uint64_t m_end_height = 0;
+  uint32_t m_num_partitions = 0;
+  std::vector<std::shared_ptr<monero_tx_wallet>> m_txs;
+  std::vector<std::shared_ptr<monero_output_wallet>> m_outputs;
+};
+
+/**
+ * Models the result of creating transactions for many configs.
+ */
+struct monero_tx_batch_result {
+  std::vector<std::vector<std::shared_ptr<monero_tx_wallet>>> m_txs;
+  std::vector<boost::optional<std::string>> m_errors;
+};
+
+/**
+ * Models the result of running many proof checks.
+ */
+struct monero_check_batch_result {
+  std::vector<std::shared_ptr<monero_check>> m_checks;
+  std::vector<boost::optional<std::string>> m_errors;
+};
+
+/**
+ * Models the result of verifying many message signatures.
+ */
+struct monero_message_batch_result {
+  std::vector<std::shared_ptr<monero_message_signature_result>> m_results;
+  std::vector<boost::optional<std::string>> m_errors;
+};
+
+/**
+ * Models the result of signing many unsigned tx sets.
+ */
+struct monero_tx_set_batch_result {
+  std::vector<monero_tx_set> m_tx_sets;
+  std::vector<boost::optional<std::string>> m_errors;
+};
+
+/**
+ * Models wallet outputs as contiguous columns, one entry per output.
+ */
+struct monero_output_columns {
+  std::vector<uint64_t> m_amounts;
+  std::vector<std::string> m_key_images;
+  std::vector<uint32_t> m_account_indices;
+  std::vector<uint32_t> m_subaddress_indices;
+  std::vector<uint8_t> m_is_spent;
+  std::vector<uint8_t> m_is_frozen;
+  std::vector<uint8_t> m_is_unlocked;
+  std::vector<uint64_t> m_heights;
+};
+
+/**
+ * Per-subaddress balance table of a wallet.
+ *
+ * Output notifications are applied as deltas to the affected entry. The table is only
+ * rebuilt in one pass over the wallet's subaddresses when the wallet's balance totals
+ * disagree with the table, e.g. as outputs unlock or pool txs add change.
+ */
+class monero_balance_index : public monero_wallet_listener {
+public:
+  monero_balance_index(const std::shared_ptr<monero_wallet>& wallet);
+  ~monero_balance_index();
+
+  uint64_t get_balance(uint32_t account_idx, uint32_t subaddress_idx);
+  uint64_t get_unlocked_balance(uint32_t account_idx, uint32_t subaddress_idx);
+  std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> get_balances();
+  void invalidate() { m_stale = true; }
+  void refresh();
+  void close();
+
+  void on_balances_changed(uint64_t new_balance, uint64_t new_unlocked_balance) override;
+  void on_output_received(const monero_output_wallet& output) override;
+  void on_output_spent(const monero_output_wallet& output) override;
+
+private:
+  std::shared_ptr<monero_wallet> m_wallet;
+  std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> m_balances;
+  uint64_t m_balance = 0;
+  uint64_t m_unlocked_balance = 0;
+  std::mutex m_mutex;
+  std::atomic<bool> m_stale;
+  std::atomic<bool> m_closed{false};
+  std::atomic<uint32_t> m_num_refreshing{0};
+
+  const std::pair<uint64_t, uint64_t>& get_entry(uint32_t account_idx, uint32_t subaddress_idx);
+  void apply_delta(const monero_output_wallet& output, bool is_spent);
+  void refresh_if_stale();
+};
+
+/**
+ * Local address to subaddress index table of a wallet.
+ *
+ * Subaddresses are keyed by their 32-byte spend public key in a flat open addressing
+ * table with linear probing. A parallel array of one byte tags is scanned first so
+ * probes rarely touch the entries, and memory stays at about 56 bytes per subaddress.
+ */
+class monero_subaddress_lookup {
+public:
+  monero_subaddress_lookup(const std::shared_ptr<monero_wallet>& wallet);
+
+  monero_subaddress get_address_index(const std::string& address) const;
+  bool contains(const std::string& address) const;
+  size_t size() const;
+  size_t get_capacity() const;
+  void add_subaddresses(const std::vector<monero_subaddress>& subaddresses);
+  std::vector<monero_subaddress> create_subaddresses(uint32_t account_idx, uint32_t count, const std::vector<std::string>& labels);
+  void refresh();
+
+private:
+  using spend_key = std::array<uint8_t, 32>;
+
+  struct entry {
+    spend_key m_spend_key;
+    uint32_t m_account_idx;
+    uint32_t m_subaddress_idx;
+  };
+
+  struct table {
+    std::vector<uint8_t> m_tags;
+    std::vector<entry> m_entries;
+    size_t m_size = 0;
+
+    const entry* find(const spend_key& key) const;
+    void insert(const spend_key& key, uint32_t account_idx, uint32_t subaddress_idx);
+    void reserve(size_t size);
+  };
+
+  std::shared_ptr<monero_wallet> m_wallet;
+  monero_network_type m_network_type;
+  table m_table;
+  mutable std::mutex m_mutex;
+
+  bool get_spend_key(const std::string& address, spend_key& key) const;
+  std::vector<spend_key> get_spend_keys(const std::vector<monero_subaddress>& subaddresses) const;
+};
+
+/**
+ * Binding state shared by every python handle of a native wallet.
+ *
+ * The state is released when the wallet is closed or destroyed.
+ */
+class PyMoneroWalletState {
+public:
+  static std::shared_ptr<PyMoneroWalletState> get(const std::shared_ptr<monero_wallet>& wallet);
+  static void remove(const monero_wallet* wallet);
+
+  // background sync period, 0 while background syncing is disabled
+  std::atomic<uint64_t> m_sync_period_in_ms{0};
+  // serializes saves of the wallet, whether blocking or async
+  std::mutex m_save_mutex;
+
+private:
+  static std::mutex s_mutex;
+  static std::unordered_map<const monero_wallet*, std::shared_ptr<PyMoneroWalletState>> s_states;
+
+  std::weak_ptr<monero_wallet> m_wallet;
+};
+
+/**
+ * Forwards the notifications of one sync and stops that sync once cancelled.
+ *
+ * The sync is stopped from its own notifications, so syncs which are not
+ * listened to by this instance are never interrupted.
+ */
+class monero_cancellable_sync_listener : public monero_wallet_listener {
+public:
+  monero_cancellable_sync_listener(const std::shared_ptr<monero_wallet>& wallet, monero_wallet_listener* listener) : m_wallet(*wallet), m_state(PyMoneroWalletState::get(wallet)), m_listener(listener) { }
+
+  void cancel() { m_cancelled = true; }
+  bool is_cancelled() const { return m_cancelled.load(); }
+  void restore_syncing();
+
+  void on_sync_progress(uint64_t height, uint64_t start_height, uint64_t end_height, double percent_done, const std::string& message) override;
+  void on_new_block(uint64_t height) override;
+  void on_balances_changed(uint64_t new_balance, uint64_t new_unlocked_balance) override;
+  void on_output_received(const monero_output_wallet& output) override;
+  void on_output_spent(const monero_output_wallet& output) override;
+
+private:
+  monero_wallet& m_wallet;
+  std::shared_ptr<PyMoneroWalletState> m_state;
+  monero_wallet_listener* m_listener;
+  std::atomic<bool> m_cancelled{false};
+  std::atomic<bool> m_stopped{false};
+
+  void stop_if_cancelled();
+};
+
 
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<monero_tx_wallet>>);
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<monero_output_wallet>>);
@@ -591,3 +817,85 @@ public:
   }
 
 };
+
+/**
+ * Collection of wallet utilities.
+ */
+class PyMoneroWalletUtils {
+public:
+  static std::map<std::pair<uint32_t, uint32_t>, std::pair<uint64_t, uint64_t>> get_balances(const monero_wallet& wallet);
+  static monero_output_columns get_outputs_columns(const monero_wallet& wallet, const monero_output_query& query);
+  static monero_tx_batch_result create_txs_batch(monero_wallet& wallet, const std::vector<std::shared_ptr<monero_tx_config>>& configs);
+  static monero_tx_set_batch_result sign_txs_batch(monero_wallet& wallet, const std::vector<std::string>& unsigned_tx_hexes);
+  static monero_check_batch_result check_tx_keys(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads);
+  static monero_check_batch_result check_tx_proofs(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string, std::string>>& checks, uint32_t num_threads);
+  static monero_check_batch_result check_spend_proofs(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads);
+  static monero_message_batch_result verify_messages(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& messages, uint32_t num_threads);
+  static monero_check_batch_result check_reserve_proofs(monero_wallet& wallet, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads);
+  static std::vector<monero_subaddress> create_subaddresses(monero_wallet& wallet, uint32_t account_idx, uint32_t count, const std::vector<std::string>& labels);
+  static void merge_key_image_import_result(monero_key_image_import_result& result, const monero_key_image_import_result& chunk_result);
+  static std::vector<std::shared_ptr<monero_block>> deserialize_blocks(const std::string& json, bool use_arena = false);
+  static std::string serialize_txs(const std::vector<std::shared_ptr<monero_tx_wallet>>& txs);
+  static std::string serialize_transfers(const std::vector<std::shared_ptr<monero_transfer>>& transfers);
+  static std::vector<std::shared_ptr<monero_tx_wallet>> deserialize_txs(const std::string& json, bool use_arena = false);
+  static std::vector<std::shared_ptr<monero_transfer>> deserialize_transfers(const std::string& json, bool use_arena = false);
+  static std::vector<std::shared_ptr<monero_output_wallet>> deserialize_outputs(const std::string& json, bool use_arena = false);
+  static std::string serialize_graph(const std::vector<std::shared_ptr<serializable_struct>>& objects);
+  static std::vector<std::shared_ptr<serializable_struct>> deserialize_graph(const std::string& data);
+
+  template<class T>
+  static std::vector<std::shared_ptr<T>> deserialize_graph_objects(const std::string& data) {
+    std::vector<std::shared_ptr<T>> objects;
+    for (const auto& object : deserialize_graph(data)) {
+      auto typed_object = std::dynamic_pointer_cast<T>(object);
+      if (object != nullptr && typed_object == nullptr) throw std::runtime_error("Unexpected object type in graph data");
+      objects.push_back(typed_object);
+    }
+    return objects;
+  }
+
+  template<class T>
+  static std::shared_ptr<T> deserialize_graph_object(const std::string& data) {
+    auto objects = deserialize_graph_objects<T>(data);
+    if (objects.size() != 1 || objects[0] == nullptr) throw std::runtime_error("Expected one object in graph data");
+    return objects[0];
+  }
+
+  /**
+   * Project one scalar field of each object, with None for null objects and unset fields.
+   */
+  template<class T>
+  static py::list get_column(const std::vector<std::shared_ptr<T>>& objects, const std::string& name);
+
+  /**
+   * Project one integer or bool field of each object, with fill for null objects and unset fields.
+   */
+  template<class T>
+  static std::vector<uint64_t> get_uint64_column(const std::vector<std::shared_ptr<T>>& objects, const std::string& name, uint64_t fill);
+
+  /**
+   * Stable sort by one or more column keys, descending for keys prefixed with '-'.
+   */
+  template<class T>
+  static void sort_by(std::vector<std::shared_ptr<T>>& objects, const std::vector<std::string>& keys, uint32_t num_threads);
+
+  template<class T>
+  static std::vector<std::string> get_column_names();
+
+  /**
+   * Keep the objects which meet the criteria of a tx, transfer or output query.
+   */
+  template<class T, class Q>
+  static std::vector<std::shared_ptr<T>> filter(const std::vector<std::shared_ptr<T>>& objects, const Q& query) {
+    std::vector<std::shared_ptr<T>> result;
+    for (const auto& object : objects) {
+      if (object != nullptr && query.meets_criteria(object.get())) result.push_back(object);
+    }
+    return result;
+  }
+  static monero_partition_scan_result scan_partitioned(const monero_wallet& wallet, uint64_t start_height, const boost::optional<uint64_t>& end_height, uint32_t num_partitions, monero_partition_scan_listener* listener);
+
+private:
+  static void run_with_clones(monero_wallet& wallet, size_t num_items, uint32_t num_threads, const std::function<void(monero_wallet&, size_t)>& task);
+  static monero_check_batch_result run_checks(monero_wallet& wallet, size_t num_checks, uint32_t num_threads, const std::function<std::shared_ptr<monero_check>(monero_wallet&, size_t)>& check);
+};
@@ -155,6 +155,11 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
   // monero_incoming_transfer
   t.py_monero_incoming_transfer
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_incoming_transfer>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_incoming_transfer>(state));
+    }))
     .def_readwrite("address", &monero_incoming_transfer::m_address)
     .def_readwrite("subaddress_index", &monero_incoming_transfer::m_subaddress_index)
     .def_readwrite("num_suggested_confirmations", &monero_incoming_transfer::m_num_suggested_confirmations)
@@ -173,6 +178,11 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
   // monero_outgoing_transfer
   t.py_monero_outgoing_transfer
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_outgoing_transfer>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_outgoing_transfer>(state));
+    }))
     .def_readwrite("subaddress_indices", &monero_outgoing_transfer::m_subaddress_indices)
     .def_readwrite("addresses", &monero_outgoing_transfer::m_addresses)
     .def_readwrite("destinations", &monero_outgoing_transfer::m_destinations)
@@ -228,6 +238,11 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
   // monero_output_wallet
   t.py_monero_output_wallet
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_output_wallet>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_output_wallet>(state));
+    }))
     .def_readwrite("account_index", &monero_output_wallet::m_account_index)
     .def_readwrite("subaddress_index", &monero_output_wallet::m_subaddress_index)
     .def_readwrite("is_spent", &monero_output_wallet::m_is_spent)
@@ -279,6 +294,11 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
   // monero_tx_wallet
   t.py_monero_tx_wallet
     .def(py::init<>())
+    .def(py::pickle([](const std::shared_ptr<monero_tx_wallet>& self) {
+      MONERO_CATCH_AND_RETHROW(py::bytes(PyMoneroWalletUtils::serialize_graph({ self })));
+    }, [](const py::bytes& state) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::deserialize_graph_object<monero_tx_wallet>(state));
+    }))
     .def_readwrite("tx_set", &monero_tx_wallet::m_tx_set)
     .def_readwrite("is_incoming", &monero_tx_wallet::m_is_incoming)
     .def_readwrite("is_outgoing", &monero_tx_wallet::m_is_outgoing)
@@ -533,6 +553,118 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
       MONERO_CATCH_AND_RETHROW(self.on_output_spent(output));
     }, py::arg("output"));
 
+  // monero_partition_scan_listener
+  t.py_monero_partition_scan_listener
+    .def(py::init<>())
+    .def("on_partition_progress", [](monero_partition_scan_listener& self, uint32_t partition_idx, uint64_t height, uint64_t start_height, uint64_t end_height, double blocks_per_second) {
+      MONERO_CATCH_AND_RETHROW(self.on_partition_progress(partition_idx, height, start_height, end_height, blocks_per_second));
+    }, py::arg("partition_idx"), py::arg("height"), py::arg("start_height"), py::arg("end_height"), py::arg("blocks_per_second"));
+
+  // monero_partition_scan_result
+  t.py_monero_partition_scan_result
+    .def(py::init<>())
+    .def_readwrite("start_height", &monero_partition_scan_result::m_start_height)
+    .def_readwrite("end_height", &monero_partition_scan_result::m_end_height)
+    .def_readwrite("num_partitions", &monero_partition_scan_result::m_num_partitions)
+    .def_readwrite("txs", &monero_partition_scan_result::m_txs)
+    .def_readwrite("outputs", &monero_partition_scan_result::m_outputs);
+
+  // monero_output_columns
+  t.py_monero_output_columns
+    .def(py::init<>())
+    .def_readwrite("amounts", &monero_output_columns::m_amounts)
+    .def_readwrite("key_images", &monero_output_columns::m_key_images)
+    .def_readwrite("account_indices", &monero_output_columns::m_account_indices)
+    .def_readwrite("subaddress_indices", &monero_output_columns::m_subaddress_indices)
+    .def_readwrite("is_spent", &monero_output_columns::m_is_spent)
+    .def_readwrite("is_frozen", &monero_output_columns::m_is_frozen)
+    .def_readwrite("is_unlocked", &monero_output_columns::m_is_unlocked)
+    .def_readwrite("heights", &monero_output_columns::m_heights)
+    .def("__len__", [](const monero_output_columns& self) {
+      return self.m_amounts.size();
+    });
+
+  // monero_tx_batch_result
+  t.py_monero_tx_batch_result
+    .def(py::init<>())
+    .def_readwrite("txs", &monero_tx_batch_result::m_txs)
+    .def_readwrite("errors", &monero_tx_batch_result::m_errors);
+
+  // monero_tx_set_batch_result
+  t.py_monero_tx_set_batch_result
+    .def(py::init<>())
+    .def_readwrite("tx_sets", &monero_tx_set_batch_result::m_tx_sets)
+    .def_readwrite("errors", &monero_tx_set_batch_result::m_errors);
+
+  // monero_check_batch_result
+  t.py_monero_check_batch_result
+    .def(py::init<>())
+    .def_readwrite("checks", &monero_check_batch_result::m_checks)
+    .def_readwrite("errors", &monero_check_batch_result::m_errors);
+
+  // monero_message_batch_result
+  t.py_monero_message_batch_result
+    .def(py::init<>())
+    .def_readwrite("results", &monero_message_batch_result::m_results)
+    .def_readwrite("errors", &monero_message_batch_result::m_errors);
+
+  // monero_balance_index
+  t.py_monero_balance_index
+    .def(py::init([](const std::shared_ptr<monero_wallet>& wallet) {
+      py::gil_scoped_release release;
+      // wallet listeners are removed without the gil to not block notifying threads
+      return std::shared_ptr<monero_balance_index>(new monero_balance_index(wallet), [](monero_balance_index* index) {
+        if (PyGILState_Check()) {
+          py::gil_scoped_release release;
+          delete index;
+        }
+        else delete index;
+      });
+    }), py::arg("wallet"))
+    .def("get_balance", [](monero_balance_index& self, uint32_t account_idx, uint32_t subaddress_idx) {
+      MONERO_CATCH_AND_RETHROW(self.get_balance(account_idx, subaddress_idx));
+    }, py::arg("account_idx"), py::arg("subaddress_idx"), py::call_guard<py::gil_scoped_release>())
+    .def("get_unlocked_balance", [](monero_balance_index& self, uint32_t account_idx, uint32_t subaddress_idx) {
+      MONERO_CATCH_AND_RETHROW(self.get_unlocked_balance(account_idx, subaddress_idx));
+    }, py::arg("account_idx"), py::arg("subaddress_idx"), py::call_guard<py::gil_scoped_release>())
+    .def("get_balances", [](monero_balance_index& self) {
+      MONERO_CATCH_AND_RETHROW(self.get_balances());
+    }, py::call_guard<py::gil_scoped_release>())
+    .def("invalidate", [](monero_balance_index& self) {
+      self.invalidate();
+    })
+    .def("refresh", [](monero_balance_index& self) {
+      MONERO_CATCH_AND_RETHROW(self.refresh());
+    }, py::call_guard<py::gil_scoped_release>())
+    .def("close", [](monero_balance_index& self) {
+      MONERO_CATCH_AND_RETHROW(self.close());
+    }, py::call_guard<py::gil_scoped_release>());
+
+  // monero_subaddress_lookup
+  t.py_monero_subaddress_lookup
+    .def(py::init<const std::shared_ptr<monero_wallet>&>(), py::arg("wallet"), py::call_guard<py::gil_scoped_release>())
+    .def("get_address_index", [](const monero_subaddress_lookup& self, const std::string& address) {
+      MONERO_CATCH_AND_RETHROW(self.get_address_index(address));
+    }, py::arg("address"), py::call_guard<py::gil_scoped_release>())
+    .def("add_subaddresses", [](monero_subaddress_lookup& self, const std::vector<monero_subaddress>& subaddresses) {
+      MONERO_CATCH_AND_RETHROW(self.add_subaddresses(subaddresses));
+    }, py::arg("subaddresses"), py::call_guard<py::gil_scoped_release>())
+    .def("create_subaddresses", [](monero_subaddress_lookup& self, uint32_t account_idx, uint32_t count, const std::vector<std::string>& labels) {
+      MONERO_CATCH_AND_RETHROW(self.create_subaddresses(account_idx, count, labels));
+    }, py::arg("account_idx"), py::arg("count"), py::arg("labels") = std::vector<std::string>(), py::call_guard<py::gil_scoped_release>())
+    .def("refresh", [](monero_subaddress_lookup& self) {
+      MONERO_CATCH_AND_RETHROW(self.refresh());
+    }, py::call_guard<py::gil_scoped_release>())
+    .def("__contains__", [](const monero_subaddress_lookup& self, const std::string& address) {
+      return self.contains(address);
+    }, py::arg("address"))
+    .def("get_capacity", [](const monero_subaddress_lookup& self) {
+      return self.get_capacity();
+    })
+    .def("__len__", [](const monero_subaddress_lookup& self) {
+      return self.size();
+    });
+
   // monero_wallet
   t.py_monero_wallet
     .def(py::init<>())
@@ -639,11 +771,14 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("sync", [](PyMoneroWallet& self, uint64_t start_height, monero_wallet_listener& listener) {
       MONERO_CATCH_AND_RETHROW(self.sync(start_height, listener));
     }, py::arg("start_height"), py::arg("listener"), py::call_guard<py::gil_scoped_release>())
-    .def("start_syncing", [](PyMoneroWallet& self, uint64_t sync_period_in_ms) {
-      MONERO_CATCH_AND_RETHROW(self.start_syncing(sync_period_in_ms));
+    .def("start_syncing", [](const std::shared_ptr<monero_wallet>& self, uint64_t sync_period_in_ms) {
+      // remembered so a cancelled sync_async can restore background syncing
+      PyMoneroWalletState::get(self)->m_sync_period_in_ms = sync_period_in_ms;
+      MONERO_CATCH_AND_RETHROW(self->start_syncing(sync_period_in_ms));
     }, py::arg("sync_period_in_ms") = 10000, py::call_guard<py::gil_scoped_release>())
-    .def("stop_syncing", [](PyMoneroWallet& self) {
-      MONERO_CATCH_AND_RETHROW(self.stop_syncing());
+    .def("stop_syncing", [](const std::shared_ptr<monero_wallet>& self) {
+      PyMoneroWalletState::get(self)->m_sync_period_in_ms = 0;
+      MONERO_CATCH_AND_RETHROW(self->stop_syncing());
     }, py::call_guard<py::gil_scoped_release>())
     .def("scan_txs", [](PyMoneroWallet& self, const std::vector<std::string>& tx_hashes) {
       MONERO_CATCH_AND_RETHROW(self.scan_txs(tx_hashes));
@@ -672,6 +807,9 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("get_unlocked_balance", [](PyMoneroWallet& self, uint32_t account_idx, uint32_t subaddress_idx) {
       MONERO_CATCH_AND_RETHROW(self.get_unlocked_balance(account_idx, subaddress_idx));
     }, py::arg("account_idx"), py::arg("subaddress_idx"), py::call_guard<py::gil_scoped_release>())
+    .def("get_balances", [](PyMoneroWallet& self) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_balances(self));
+    }, py::call_guard<py::gil_scoped_release>())
     .def("get_accounts", [](PyMoneroWallet& self) {
       MONERO_CATCH_AND_RETHROW(self.get_accounts());
     }, py::call_guard<py::gil_scoped_release>())
@@ -717,6 +855,9 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("create_subaddress", [](PyMoneroWallet& self, uint32_t account_idx, const std::string& label) {
       MONERO_CATCH_AND_RETHROW(self.create_subaddress(account_idx, label));
     }, py::arg("account_idx"), py::arg("label") = "", py::call_guard<py::gil_scoped_release>())
+    .def("create_subaddresses", [](PyMoneroWallet& self, uint32_t account_idx, uint32_t count, const std::vector<std::string>& labels) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::create_subaddresses(self, account_idx, count, labels));
+    }, py::arg("account_idx"), py::arg("count"), py::arg("labels") = std::vector<std::string>(), py::call_guard<py::gil_scoped_release>())
     .def("set_subaddress_label", [](PyMoneroWallet& self, uint32_t account_idx, uint32_t subaddress_idx, const std::string& label) {
       MONERO_CATCH_AND_RETHROW(self.set_subaddress_label(account_idx, subaddress_idx, label));
     }, py::arg("account_idx"), py::arg("subaddress_idx"), py::arg("label") = "", py::call_guard<py::gil_scoped_release>())
@@ -764,18 +905,86 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
       monero_output_query query;
       MONERO_CATCH_AND_RETHROW(self.get_outputs(query));
     }, py::call_guard<py::gil_scoped_release>())
+    .def("get_outputs_columns", [](PyMoneroWallet& self, const std::shared_ptr<monero_output_query>& query) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::get_outputs_columns(self, query == nullptr ? monero_output_query() : *query));
+    }, py::arg("query") = py::none(), py::call_guard<py::gil_scoped_release>())
     .def("export_outputs", [](PyMoneroWallet& self, bool all) {
       MONERO_CATCH_AND_RETHROW(self.export_outputs(all));
     }, py::arg("all") = false, py::call_guard<py::gil_scoped_release>())
     .def("import_outputs", [](PyMoneroWallet& self, const std::string& outputs_hex) {
       MONERO_CATCH_AND_RETHROW(self.import_outputs(outputs_hex));
     }, py::arg("outputs_hex"), py::call_guard<py::gil_scoped_release>())
+    .def("export_outputs_bytes", [](PyMoneroWallet& self, bool all) {
+      std::string outputs;
+      {
+        py::gil_scoped_release release;
+        std::string outputs_hex = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(self.export_outputs(all)); }();
+        outputs = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(PyGenUtils::hex_to_binary(outputs_hex.data(), outputs_hex.size())); }();
+      }
+      return py::bytes(outputs);
+    }, py::arg("all") = false)
+    .def("export_outputs_to", [](PyMoneroWallet& self, const py::object& stream, bool all, uint32_t chunk_size) {
+      if (chunk_size == 0) throw py::value_error("chunk_size must be greater than 0");
+      std::string outputs_hex;
+      {
+        py::gil_scoped_release release;
+        outputs_hex = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(self.export_outputs(all)); }();
+      }
+      // decode one chunk at a time so the binary form is never held in full
+      py::object write = stream.attr("write");
+      size_t hex_chunk_size = static_cast<size_t>(chunk_size) * 2;
+      for (size_t pos = 0; pos < outputs_hex.size(); pos += hex_chunk_size) {
+        size_t len = std::min(hex_chunk_size, outputs_hex.size() - pos);
+        std::string chunk = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(PyGenUtils::hex_to_binary(outputs_hex.data() + pos, len)); }();
+        write(py::bytes(chunk));
+      }
+      return static_cast<uint64_t>(outputs_hex.size() / 2);
+    }, py::arg("stream"), py::arg("all") = false, py::arg("chunk_size") = 65536)
+    .def("import_outputs_bytes", [](PyMoneroWallet& self, const py::buffer& outputs) {
+      std::string outputs_hex;
+      PyGenUtils::append_buffer_hex(outputs_hex, outputs);
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(self.import_outputs(outputs_hex));
+    }, py::arg("outputs"))
+    .def("import_outputs_from", [](PyMoneroWallet& self, const py::object& stream, uint32_t chunk_size) {
+      if (chunk_size == 0) throw py::value_error("chunk_size must be greater than 0");
+      // only reading is chunked, the wallet imports the whole export from one hex string
+      std::string outputs_hex;
+      py::object read = stream.attr("read");
+      while (true) {
+        py::object chunk = read(chunk_size);
+        if (chunk.is_none() || PyGenUtils::append_buffer_hex(outputs_hex, chunk) == 0) break;
+      }
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(self.import_outputs(outputs_hex));
+    }, py::arg("stream"), py::arg("chunk_size") = 65536)
     .def("export_key_images", [](PyMoneroWallet& self, bool all) {
       MONERO_CATCH_AND_RETHROW(self.export_key_images(all));
     }, py::arg("all") = false, py::call_guard<py::gil_scoped_release>())
     .def("import_key_images", [](PyMoneroWallet& self, const std::vector<std::shared_ptr<monero_key_image>>& key_images, uint64_t offset) {
-      MONERO_CATCH_AND_RETHROW(self.import_key_images(key_images));
+      MONERO_CATCH_AND_RETHROW(self.import_key_images(key_images, offset));
     }, py::arg("key_images"), py::arg("offset") = 0, py::call_guard<py::gil_scoped_release>())
+    .def("import_key_images_chunked", [](PyMoneroWallet& self, const py::iterable& key_images, uint32_t chunk_size, uint64_t offset, const boost::optional<py::function>& progress) {
+      if (chunk_size == 0) throw py::value_error("chunk_size must be greater than 0");
+      auto result = std::make_shared<monero_key_image_import_result>();
+      std::vector<std::shared_ptr<monero_key_image>> chunk;
+      chunk.reserve(chunk_size);
+      auto it = py::iter(key_images);
+      while (it != py::iterator::sentinel()) {
+        // pull the next chunk with the gil, import it without
+        chunk.clear();
+        for (; it != py::iterator::sentinel() && chunk.size() < chunk_size; ++it) chunk.push_back(it->cast<std::shared_ptr<monero_key_image>>());
+        std::shared_ptr<monero_key_image_import_result> chunk_result;
+        {
+          py::gil_scoped_release release;
+          chunk_result = [&]() -> std::shared_ptr<monero_key_image_import_result> { MONERO_CATCH_AND_RETHROW(self.import_key_images(chunk, offset)); }();
+        }
+        if (chunk_result != nullptr) PyMoneroWalletUtils::merge_key_image_import_result(*result, *chunk_result);
+        offset += chunk.size();
+        if (progress != boost::none) progress.get()(offset);
+      }
+      return result;
+    }, py::arg("key_images"), py::arg("chunk_size") = 1000, py::arg("offset") = 0, py::arg("progress") = py::none())
     .def("get_new_key_images_from_last_import", [](PyMoneroWallet& self) {
       MONERO_CATCH_AND_RETHROW(self.export_key_images(false));
     }, py::call_guard<py::gil_scoped_release>())
@@ -797,6 +1006,9 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("create_txs", [](PyMoneroWallet& self, const monero_tx_config& config) {
       MONERO_CATCH_AND_RETHROW(self.create_txs(config));
     }, py::arg("config"), py::call_guard<py::gil_scoped_release>())
+    .def("create_txs_batch", [](PyMoneroWallet& self, const std::vector<std::shared_ptr<monero_tx_config>>& configs) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::create_txs_batch(self, configs));
+    }, py::arg("configs"), py::call_guard<py::gil_scoped_release>())
     .def("sweep_unlocked", [](PyMoneroWallet& self, const monero_tx_config& config) {
       MONERO_CATCH_AND_RETHROW(self.sweep_unlocked(config));
     }, py::arg("config"), py::call_guard<py::gil_scoped_release>())
@@ -834,6 +1046,9 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("sign_txs", [](PyMoneroWallet& self, const std::string& unsigned_tx_hex) {
       MONERO_CATCH_AND_RETHROW(self.sign_txs(unsigned_tx_hex));
     }, py::arg("unsigned_tx_hex"), py::call_guard<py::gil_scoped_release>())
+    .def("sign_txs_batch", [](PyMoneroWallet& self, const std::vector<std::string>& unsigned_tx_hexes) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::sign_txs_batch(self, unsigned_tx_hexes));
+    }, py::arg("unsigned_tx_hexes"), py::call_guard<py::gil_scoped_release>())
     .def("submit_txs", [](PyMoneroWallet& self, const std::string& signed_tx_hex) {
       MONERO_CATCH_AND_RETHROW(self.submit_txs(signed_tx_hex));
     }, py::arg("signed_tx_hex"), py::call_guard<py::gil_scoped_release>())
@@ -848,6 +1063,9 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
         return monero_message_signature_result();
       }
     }, py::arg("msg"), py::arg("address"), py::arg("signature"), py::call_guard<py::gil_scoped_release>())
+    .def("verify_messages", [](PyMoneroWallet& self, const std::vector<std::tuple<std::string, std::string, std::string>>& messages, uint32_t num_threads) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::verify_messages(self, messages, num_threads));
+    }, py::arg("messages"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>())
     .def("get_tx_key", [](PyMoneroWallet& self, const std::string& tx_hash) {
       MONERO_CATCH_AND_RETHROW(self.get_tx_key(tx_hash));
     }, py::arg("tx_hash"), py::call_guard<py::gil_scoped_release>())
@@ -875,6 +1093,18 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("check_reserve_proof", [](PyMoneroWallet& self, const std::string& address, const std::string& message, const std::string& signature) {
       MONERO_CATCH_AND_RETHROW(self.check_reserve_proof(address, message, signature));
     }, py::arg("address"), py::arg("message"), py::arg("signature"), py::call_guard<py::gil_scoped_release>())
+    .def("check_tx_keys", [](PyMoneroWallet& self, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::check_tx_keys(self, checks, num_threads));
+    }, py::arg("checks"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>())
+    .def("check_tx_proofs", [](PyMoneroWallet& self, const std::vector<std::tuple<std::string, std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::check_tx_proofs(self, checks, num_threads));
+    }, py::arg("checks"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>())
+    .def("check_spend_proofs", [](PyMoneroWallet& self, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::check_spend_proofs(self, checks, num_threads));
+    }, py::arg("checks"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>())
+    .def("check_reserve_proofs", [](PyMoneroWallet& self, const std::vector<std::tuple<std::string, std::string, std::string>>& checks, uint32_t num_threads) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::check_reserve_proofs(self, checks, num_threads));
+    }, py::arg("checks"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>())
     .def("get_tx_note", [](PyMoneroWallet& self, const std::string& tx_hash) {
       MONERO_CATCH_AND_RETHROW(self.get_tx_note(tx_hash));
     }, py::arg("tx_hash"), py::call_guard<py::gil_scoped_release>())
@@ -981,12 +1211,80 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def("move_to", [](PyMoneroWallet& self, const std::string& path, const std::string& password) {
       MONERO_CATCH_AND_RETHROW(self.move_to(path, password));
     }, py::arg("path"), py::arg("password"), py::call_guard<py::gil_scoped_release>())
-    .def("save", [](PyMoneroWallet& self) {
-      MONERO_CATCH_AND_RETHROW(self.save());
+    .def("save", [](const std::shared_ptr<monero_wallet>& self) {
+      auto state = PyMoneroWalletState::get(self);
+      std::lock_guard<std::mutex> lock(state->m_save_mutex);
+      MONERO_CATCH_AND_RETHROW(self->save());
     }, py::call_guard<py::gil_scoped_release>())
-    .def("close", [](monero_wallet& self, bool save) {
-      MONERO_CATCH_AND_RETHROW(self.close(save));
+    .def("close", [](const std::shared_ptr<monero_wallet>& self, bool save) {
+      // waits for a save in progress
+      auto state = PyMoneroWalletState::get(self);
+      std::lock_guard<std::mutex> lock(state->m_save_mutex);
+      PyMoneroWalletState::remove(self.get());
+      MONERO_CATCH_AND_RETHROW(self->close(save));
     }, py::arg("save") = false, py::call_guard<py::gil_scoped_release>())
+    .def("sync_async", [](const std::shared_ptr<monero_wallet>& self, const boost::optional<uint64_t>& start_height, const py::object& listener) {
+      // cancelling the future only stops the sync started by this task
+      auto sync_listener = std::make_shared<monero_cancellable_sync_listener>(self, listener.is_none() ? nullptr : listener.cast<monero_wallet_listener*>());
+      return PyMoneroAsync::run([self, start_height, sync_listener]() {
+        try {
+          monero_sync_result result = start_height == boost::none ? self->sync(*sync_listener) : self->sync(start_height.get(), *sync_listener);
+          sync_listener->restore_syncing();
+          return result;
+        } catch (...) {
+          sync_listener->restore_syncing();
+          throw;
+        }
+      }, [sync_listener]() { sync_listener->cancel(); }, listener);
+    }, py::arg("start_height") = py::none(), py::arg("listener") = py::none())
+    .def("rescan_blockchain_async", [](const std::shared_ptr<monero_wallet>& self) {
+      auto sync_listener = std::make_shared<monero_cancellable_sync_listener>(self, nullptr);
+      return PyMoneroAsync::run([self, sync_listener]() {
+        self->add_listener(*sync_listener);
+        try {
+          self->rescan_blockchain();
+        } catch (...) {
+          self->remove_listener(*sync_listener);
+          sync_listener->restore_syncing();
+          throw;
+        }
+        self->remove_listener(*sync_listener);
+        sync_listener->restore_syncing();
+      }, [sync_listener]() { sync_listener->cancel(); });
+    })
+    .def("get_txs_async", [](const std::shared_ptr<monero_wallet>& self, const std::shared_ptr<monero_tx_query>& query) {
+      return PyMoneroAsync::run([self, query]() {
+        return query == nullptr ? self->get_txs() : PyMoneroUtils::get_and_sort_txs(*self, *query);
+      });
+    }, py::arg("query") = py::none())
+    .def("get_transfers_async", [](const std::shared_ptr<monero_wallet>& self, const std::shared_ptr<monero_transfer_query>& query) {
+      return PyMoneroAsync::run([self, query]() {
+        return self->get_transfers(query == nullptr ? monero_transfer_query() : *query);
+      });
+    }, py::arg("query") = py::none())
+    .def("get_outputs_async", [](const std::shared_ptr<monero_wallet>& self, const std::shared_ptr<monero_output_query>& query) {
+      return PyMoneroAsync::run([self, query]() {
+        return self->get_outputs(query == nullptr ? monero_output_query() : *query);
+      });
+    }, py::arg("query") = py::none())
+    .def("create_tx_async", [](const std::shared_ptr<monero_wallet>& self, const std::shared_ptr<monero_tx_config>& config) {
+      return PyMoneroAsync::run([self, config]() {
+        return self->create_tx(*config);
+      });
+    }, py::arg("config").none(false))
+    .def("create_txs_async", [](const std::shared_ptr<monero_wallet>& self, const std::shared_ptr<monero_tx_config>& config) {
+      return PyMoneroAsync::run([self, config]() {
+        return self->create_txs(*config);
+      });
+    }, py::arg("config").none(false))
+    .def("save_async", [](const std::shared_ptr<monero_wallet>& self) {
+      return PyMoneroAsync::run([self]() {
+        // saves of the same wallet must not overlap, saves of other wallets may
+        auto state = PyMoneroWalletState::get(self);
+        std::lock_guard<std::mutex> lock(state->m_save_mutex);
+        self->save();
+      });
+    })
     .def("is_closed", [](const monero_wallet& self) {
       MONERO_CATCH_AND_RETHROW(self.is_closed());
     }, py::call_guard<py::gil_scoped_release>());
@@ -1014,9 +1312,13 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
     .def_static("open_wallet", [](const std::string& path, const std::string& password, monero_network_type nettype, bool regtest) {
       MONERO_CATCH_AND_RETHROW(monero_wallet_full::open_wallet(path, password, nettype, regtest));
     }, py::arg("path"), py::arg("password"), py::arg("nettype"), py::arg("regtest") = false, py::call_guard<py::gil_scoped_release>())
-    .def_static("open_wallet_data", [](const std::string& password, monero_network_type nettype, const std::string& keys_data, const std::string& cache_data, const std::shared_ptr<monero_rpc_connection>& daemon_connection, bool regtest) {
-      MONERO_CATCH_AND_RETHROW(monero_wallet_full::open_wallet_data(password, nettype, keys_data, cache_data, daemon_connection, nullptr, regtest));
-    }, py::arg("password"), py::arg("nettype"), py::arg("keys_data"), py::arg("cache_data"), py::arg("daemon_connection") = std::make_shared<monero_rpc_connection>(), py::arg("regtest") = false, py::call_guard<py::gil_scoped_release>())
+    .def_static("open_wallet_data", [](const std::string& password, monero_network_type nettype, const py::buffer& keys_data, const py::buffer& cache_data, const std::shared_ptr<monero_rpc_connection>& daemon_connection, bool regtest) {
+      // monero-cpp takes the buffers as strings, copy them once while holding the gil
+      std::string keys = PyGenUtils::buffer_to_string(keys_data);
+      std::string cache = PyGenUtils::buffer_to_string(cache_data);
+      py::gil_scoped_release release;
+      MONERO_CATCH_AND_RETHROW(monero_wallet_full::open_wallet_data(password, nettype, keys, cache, daemon_connection, nullptr, regtest));
+    }, py::arg("password"), py::arg("nettype"), py::arg("keys_data"), py::arg("cache_data"), py::arg("daemon_connection") = std::make_shared<monero_rpc_connection>(), py::arg("regtest") = false)
     .def_static("create_wallet", [](const monero_wallet_config& config) {
       try {
         return monero_wallet_full::create_wallet(config);
@@ -1031,11 +1333,24 @@ void py_monero_bind_wallet(py::module_& m, PyMoneroTypes& t) {
       MONERO_CATCH_AND_RETHROW(monero_wallet_full::get_seed_languages());
     }, py::call_guard<py::gil_scoped_release>())
     .def("get_keys_file_buffer", [](monero_wallet_full& self, std::string& password, bool view_only) {
-      MONERO_CATCH_AND_RETHROW(self.get_keys_file_buffer(password, view_only));
-    }, py::arg("password"), py::arg("view_only"), py::call_guard<py::gil_scoped_release>())
+      std::string buffer;
+      {
+        py::gil_scoped_release release;
+        buffer = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(self.get_keys_file_buffer(password, view_only)); }();
+      }
+      return py::bytes(buffer);
+    }, py::arg("password"), py::arg("view_only"))
     .def("get_cache_file_buffer", [](monero_wallet_full& self) {
-      MONERO_CATCH_AND_RETHROW(self.get_cache_file_buffer());
-    }, py::call_guard<py::gil_scoped_release>());
+      std::string buffer;
+      {
+        py::gil_scoped_release release;
+        buffer = [&]() -> std::string { MONERO_CATCH_AND_RETHROW(self.get_cache_file_buffer()); }();
+      }
+      return py::bytes(buffer);
+    })
+    .def("scan_partitioned", [](monero_wallet_full& self, uint64_t start_height, const boost::optional<uint64_t>& end_height, uint32_t num_partitions, monero_partition_scan_listener* listener) {
+      MONERO_CATCH_AND_RETHROW(PyMoneroWalletUtils::scan_partitioned(self, start_height, end_height, num_partitions, listener));
+    }, py::arg("start_height"), py::arg("end_height") = py::none(), py::arg("num_partitions") = 0, py::arg("listener") = py::none(), py::call_guard<py::gil_scoped_release>());
 
   // monero_wallet_rpc
   t.py_monero_wallet_rpc
@@ -61,11 +61,13 @@ from .monero_account_tag import MoneroAccountTag
 from .monero_address_book_entry import MoneroAddressBookEntry
 from .monero_address_type import MoneroAddressType
 from .monero_alt_chain import MoneroAltChain
+from .monero_balance_index import MoneroBalanceIndex
 from .monero_ban import MoneroBan
 from .monero_block import MoneroBlock
 from .monero_block_header import MoneroBlockHeader
 from .monero_block_template import MoneroBlockTemplate
 from .monero_check import MoneroCheck
+from .monero_check_batch_result import MoneroCheckBatchResult
 from .monero_check_reserve import MoneroCheckReserve
 from .monero_check_tx import MoneroCheckTx
 from .monero_connection_span import MoneroConnectionSpan
@@ -83,12 +85,14 @@ from .monero_error import MoneroError
 from .monero_fee_estimate import MoneroFeeEstimate
 from .monero_generate_blocks_result import MoneroGenerateBlocksResult
 from .monero_hard_fork_info import MoneroHardForkInfo
+from .monero_hash32 import MoneroHash32
 from .monero_incoming_transfer import MoneroIncomingTransfer
 from .monero_integrated_address import MoneroIntegratedAddress
 from .monero_key_image import MoneroKeyImage
 from .monero_key_image_export_result import MoneroKeyImageExportResult
 from .monero_key_image_import_result import MoneroKeyImageImportResult
 from .monero_key_image_spent_status import MoneroKeyImageSpentStatus
+from .monero_message_batch_result import MoneroMessageBatchResult
 from .monero_message_signature_result import MoneroMessageSignatureResult
 from .monero_message_signature_type import MoneroMessageSignatureType
 from .monero_miner_tx_sum import MoneroMinerTxSum
@@ -101,26 +105,32 @@ from .monero_transfer import MoneroTransfer
 from .monero_outgoing_transfer import MoneroOutgoingTransfer
 from .monero_incoming_transfer import MoneroIncomingTransfer
 from .monero_output import MoneroOutput
+from .monero_output_columns import MoneroOutputColumns
 from .monero_output_distribution_entry import MoneroOutputDistributionEntry
 from .monero_output_histogram_entry import MoneroOutputHistogramEntry
 from .monero_output_query import MoneroOutputQuery
 from .monero_output_wallet import MoneroOutputWallet
+from .monero_partition_scan_listener import MoneroPartitionScanListener
+from .monero_partition_scan_result import MoneroPartitionScanResult
 from .monero_peer import MoneroPeer
 from .monero_prune_result import MoneroPruneResult
 from .monero_rpc_connection import MoneroRpcConnection
 from .monero_rpc_error import MoneroRpcError
 from .ssl_options import SslOptions
 from .monero_subaddress import MoneroSubaddress
+from .monero_subaddress_lookup import MoneroSubaddressLookup
 from .monero_submit_tx_result import MoneroSubmitTxResult
 from .monero_sync_result import MoneroSyncResult
 from .monero_transfer_query import MoneroTransferQuery
 from .monero_tx import MoneroTx
 from .monero_tx_backlog_entry import MoneroTxBacklogEntry
+from .monero_tx_batch_result import MoneroTxBatchResult
 from .monero_tx_config import MoneroTxConfig
 from .monero_tx_pool_stats import MoneroTxPoolStats
 from .monero_tx_priority import MoneroTxPriority
 from .monero_tx_query import MoneroTxQuery
 from .monero_tx_set import MoneroTxSet
+from .monero_tx_set_batch_result import MoneroTxSetBatchResult
 from .monero_tx_wallet import MoneroTxWallet
 from .monero_utils import MoneroUtils
 from .monero_version import MoneroVersion
@@ -139,11 +149,13 @@ __all__ = [
   'MoneroAddressBookEntry',
   'MoneroAddressType',
   'MoneroAltChain',
+  'MoneroBalanceIndex',
   'MoneroBan',
   'MoneroBlock',
   'MoneroBlockHeader',
   'MoneroBlockTemplate',
   'MoneroCheck',
+  'MoneroCheckBatchResult',
   'MoneroCheckReserve',
   'MoneroCheckTx',
   'MoneroConnectionSpan',
@@ -161,12 +173,14 @@ __all__ = [
   'MoneroFeeEstimate',
   'MoneroGenerateBlocksResult',
   'MoneroHardForkInfo',
+  'MoneroHash32',
   'MoneroIncomingTransfer',
   'MoneroIntegratedAddress',
   'MoneroKeyImage',
   'MoneroKeyImageExportResult',
   'MoneroKeyImageImportResult',
   'MoneroKeyImageSpentStatus',
+  'MoneroMessageBatchResult',
   'MoneroMessageSignatureResult',
   'MoneroMessageSignatureType',
   'MoneroMinerTxSum',
@@ -177,26 +191,32 @@ __all__ = [
   'MoneroNetworkType',
   'MoneroOutgoingTransfer',
   'MoneroOutput',
+  'MoneroOutputColumns',
   'MoneroOutputDistributionEntry',
   'MoneroOutputHistogramEntry',
   'MoneroOutputQuery',
   'MoneroOutputWallet',
+  'MoneroPartitionScanListener',
+  'MoneroPartitionScanResult',
   'MoneroPeer',
   'MoneroPruneResult',
   'MoneroRpcConnection',
   'MoneroRpcError',
   'MoneroSubaddress',
+  'MoneroSubaddressLookup',
   'MoneroSubmitTxResult',
   'MoneroSyncResult',
   'MoneroTransfer',
   'MoneroTransferQuery',
   'MoneroTx',
   'MoneroTxBacklogEntry',
+  'MoneroTxBatchResult',
   'MoneroTxConfig',
   'MoneroTxPoolStats',
   'MoneroTxPriority',
   'MoneroTxQuery',
   'MoneroTxSet',
+  'MoneroTxSetBatchResult',
   'MoneroTxWallet',
   'MoneroUtils',
   'MoneroVersion',
@@ -0,0 +1,53 @@
+from .monero_wallet import MoneroWallet
+
+
+class MoneroBalanceIndex:
+    """
+    Per-subaddress balance table of a wallet.
+
+    Received and spent outputs notified by the wallet are applied to the affected entry. The table is
+    rebuilt in one pass over the wallet's subaddresses only when the wallet's balance totals disagree
+    with it, e.g. as outputs unlock, so lookups are constant time.
+    """
+
+    def __init__(self, wallet: MoneroWallet) -> None:
+        """
+        Initialize a balance index listening to the given wallet.
+
+        :param MoneroWallet wallet: wallet to index balances of.
+        """
+        ...
+    def close(self) -> None:
+        """Stop listening to the wallet and release the table."""
+        ...
+    def get_balance(self, account_idx: int, subaddress_idx: int) -> int:
+        """
+        Get the balance of a subaddress.
+
+        :param int account_idx: index of the account.
+        :param int subaddress_idx: index of the subaddress within the account.
+        :returns int: the subaddress balance, 0 if the subaddress is unknown.
+        """
+        ...
+    def get_balances(self) -> dict[tuple[int, int], tuple[int, int]]:
+        """
+        Get the whole balance table.
+
+        :returns dict[tuple[int, int], tuple[int, int]]: (balance, unlocked balance) keyed by (account index, subaddress index).
+        """
+        ...
+    def get_unlocked_balance(self, account_idx: int, subaddress_idx: int) -> int:
+        """
+        Get the unlocked balance of a subaddress.
+
+        :param int account_idx: index of the account.
+        :param int subaddress_idx: index of the subaddress within the account.
+        :returns int: the subaddress unlocked balance, 0 if the subaddress is unknown.
+        """
+        ...
+    def invalidate(self) -> None:
+        """Mark the table stale so it is rebuilt on the next read."""
+        ...
+    def refresh(self) -> None:
+        """Rebuild the table from the wallet."""
+        ...
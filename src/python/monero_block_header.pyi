@@ -1,6 +1,7 @@
 from __future__ import annotations
 
 from .serializable_struct import SerializableStruct
+from .monero_hash32 import MoneroHash32
 
 
 class MoneroBlockHeader(SerializableStruct):
@@ -59,6 +60,14 @@ class MoneroBlockHeader(SerializableStruct):
         """
         ...
 
+    def get_hash32(self) -> MoneroHash32 | None:
+        """
+        Get the block hash as a 32-byte hash.
+
+        :returns MoneroHash32 | None: The hash of the block, if known.
+        """
+        ...
+
     def merge(self, other: MoneroBlockHeader) -> None:
         """
         Merge current block header with another one.
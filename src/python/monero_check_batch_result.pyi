@@ -0,0 +1,14 @@
+from .monero_check import MoneroCheck
+
+
+class MoneroCheckBatchResult:
+    """Models the result of running many proof checks."""
+
+    checks: list[MoneroCheck | None]
+    """Result of each check, `None` if the check could not be performed."""
+    errors: list[str | None]
+    """Error of each check, `None` if the check was performed."""
+
+    def __init__(self) -> None:
+        """Initialize a check batch result."""
+        ...
@@ -1,4 +1,5 @@
 import typing
+import asyncio
 
 from .monero_daemon_listener import MoneroDaemonListener
 from .monero_daemon_update_check_result import MoneroDaemonUpdateCheckResult
@@ -108,6 +109,15 @@ class MoneroDaemon:
         """
         ...
 
+    def get_block_by_hash_async(self, hash: str) -> asyncio.Future[MoneroBlock]:
+        """
+        Get a block by hash on the library thread pool.
+
+        :param str hash: is the hash of the block to get.
+        :returns asyncio.Future[MoneroBlock]: future of the block with the given hash.
+        """
+        ...
+
     def get_block_by_height(self, height: int) -> MoneroBlock:
         """
         Get a block by height.
@@ -117,6 +127,15 @@ class MoneroDaemon:
         """
         ...
 
+    def get_block_by_height_async(self, height: int) -> asyncio.Future[MoneroBlock]:
+        """
+        Get a block by height on the library thread pool.
+
+        :param int height: is the height of the block to get.
+        :returns asyncio.Future[MoneroBlock]: future of the block at the given height.
+        """
+        ...
+
     def get_block_hash(self, height: int) -> str:
         """
         Get a block's hash by its height.
@@ -251,6 +270,16 @@ class MoneroDaemon:
         """
         ...
 
+    def get_height_async(self) -> asyncio.Future[int]:
+        """
+        Get the number of blocks in the longest chain known to the node on the library thread pool.
+
+        Must be called from a running event loop.
+
+        :returns asyncio.Future[int]: future of the number of blocks.
+        """
+        ...
+
     def get_info(self) -> MoneroDaemonInfo:
         """
         Get general information about the state of the node and the network.
@@ -259,6 +288,14 @@ class MoneroDaemon:
         """
         ...
 
+    def get_info_async(self) -> asyncio.Future[MoneroDaemonInfo]:
+        """
+        Get general information about the state of the node and the network on the library thread pool.
+
+        :returns asyncio.Future[MoneroDaemonInfo]: future of the node and network information.
+        """
+        ...
+
     def get_key_image_spent_status(self, key_image: str) -> MoneroKeyImageSpentStatus:
         """
         Get the spent status of the given key image.
@@ -464,6 +501,16 @@ class MoneroDaemon:
         """
         ...
 
+    def get_txs_async(self, tx_hashes: list[str], prune: bool = False) -> asyncio.Future[list[MoneroTx]]:
+        """
+        Get transactions by hashes on the library thread pool.
+
+        :param list[str] tx_hashes: are hashes of transactions to get.
+        :param bool prune: Prune transactions.
+        :returns asyncio.Future[list[MoneroTx]]: future of the found transactions.
+        """
+        ...
+
     def get_upload_limit(self) -> int:
         """
         Get the upload bandwidth limit.
@@ -638,3 +685,11 @@ class MoneroDaemon:
         :returns MoneroBlockHeader: the header of the next block added to the chain.
         """
         ...
+
+    def wait_for_next_block_header_async(self) -> asyncio.Future[MoneroBlockHeader]:
+        """
+        Wait for the header of the next block added to the chain on the library thread pool.
+
+        :returns asyncio.Future[MoneroBlockHeader]: future of the header of the next block.
+        """
+        ...
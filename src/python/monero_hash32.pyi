@@ -0,0 +1,50 @@
+from __future__ import annotations
+
+import typing
+
+
+class MoneroHash32:
+    """
+    Models a fixed-size 32-byte hash or key (e.g. tx hash, block hash, key image).
+
+    Supports hashing, comparison and the buffer protocol, and converts to hex only on request.
+    """
+
+    @typing.overload
+    def __init__(self) -> None:
+        """Initialize a zero hash."""
+        ...
+    @typing.overload
+    def __init__(self, hex: str) -> None:
+        """
+        Initialize a hash from hex.
+
+        :param str hex: 64 hex characters.
+        """
+        ...
+    @staticmethod
+    def from_bytes(data: bytes | bytearray | memoryview) -> MoneroHash32:
+        """
+        Create a hash from raw bytes.
+
+        :param bytes | bytearray | memoryview data: 32 bytes.
+        :returns MoneroHash32: the hash.
+        """
+        ...
+    def hex(self) -> str:
+        """
+        Get the hash in hex format.
+
+        :returns str: 64 hex characters.
+        """
+        ...
+    def __bytes__(self) -> bytes:
+        ...
+    def __eq__(self, other: object) -> bool:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __lt__(self, other: MoneroHash32) -> bool:
+        ...
+    def __ne__(self, other: object) -> bool:
+        ...
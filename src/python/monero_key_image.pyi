@@ -1,4 +1,5 @@
 from .serializable_struct import SerializableStruct
+from .monero_hash32 import MoneroHash32
 
 
 class MoneroKeyImage(SerializableStruct):
@@ -31,6 +32,14 @@ class MoneroKeyImage(SerializableStruct):
         """
         ...
 
+    def get_hex32(self) -> MoneroHash32 | None:
+        """
+        Get the key image as a 32-byte key.
+
+        :returns MoneroHash32 | None: The key image, if known.
+        """
+        ...
+
     def merge(self, other: MoneroKeyImage) -> None:
         """
         Merge current key image with another one.
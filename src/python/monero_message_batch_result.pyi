@@ -0,0 +1,14 @@
+from .monero_message_signature_result import MoneroMessageSignatureResult
+
+
+class MoneroMessageBatchResult:
+    """Models the result of verifying many message signatures."""
+
+    results: list[MoneroMessageSignatureResult | None]
+    """Result of each verification, `None` if the signature could not be verified."""
+    errors: list[str | None]
+    """Error of each verification, `None` if the signature was verified."""
+
+    def __init__(self) -> None:
+        """Initialize a message batch result."""
+        ...
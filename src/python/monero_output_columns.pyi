@@ -0,0 +1,30 @@
+class MoneroOutputColumns:
+    """
+    Models wallet outputs as contiguous columns, one entry per output.
+
+    Numeric columns support the buffer protocol, so `numpy.asarray()` views them without copying.
+    """
+
+    amounts: list[int]
+    """Amount of each output in atomic-units (uint64)."""
+    key_images: list[str]
+    """Key image hex of each output, empty if unknown."""
+    account_indices: list[int]
+    """Account index of each output (uint32)."""
+    subaddress_indices: list[int]
+    """Subaddress index of each output (uint32)."""
+    is_spent: list[int]
+    """`1` if the output is spent, else `0` (uint8)."""
+    is_frozen: list[int]
+    """`1` if the output is frozen, else `0` (uint8)."""
+    is_unlocked: list[int]
+    """`1` if the output's transaction is unlocked, else `0` (uint8)."""
+    heights: list[int]
+    """Height of the block containing each output's transaction, `0` if unconfirmed (uint64)."""
+
+    def __init__(self) -> None:
+        """Initialize empty output columns."""
+        ...
+    def __len__(self) -> int:
+        """Get the number of outputs."""
+        ...
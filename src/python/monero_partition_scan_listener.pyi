@@ -0,0 +1,18 @@
+class MoneroPartitionScanListener:
+    """Interface to receive progress notifications from a partitioned scan."""
+
+    def __init__(self) -> None:
+        """Initialize a partition scan listener."""
+        ...
+
+    def on_partition_progress(self, partition_idx: int, height: int, start_height: int, end_height: int, blocks_per_second: float) -> None:
+        """
+        Invoked when a partition makes progress.
+
+        :param int partition_idx: index of the partition.
+        :param int height: last height scanned by the partition.
+        :param int start_height: first height of the partition.
+        :param int end_height: height the partition stops before.
+        :param float blocks_per_second: scan throughput of the partition.
+        """
+        ...
@@ -0,0 +1,26 @@
+from .monero_tx_wallet import MoneroTxWallet
+from .monero_output_wallet import MoneroOutputWallet
+
+
+class MoneroPartitionScanResult:
+    """
+    Models the result of a partitioned scan.
+
+    The result is a read-only report which is not applied to the scanned wallet. Outgoing transactions
+    which spend outputs received in an earlier partition are not included.
+    """
+
+    start_height: int
+    """First height scanned."""
+    end_height: int
+    """Height the scan stopped before."""
+    num_partitions: int
+    """Number of partitions scanned concurrently."""
+    txs: list[MoneroTxWallet]
+    """Transactions found, in height order."""
+    outputs: list[MoneroOutputWallet]
+    """Outputs found, in height order."""
+
+    def __init__(self) -> None:
+        """Initialize a partition scan result."""
+        ...
@@ -0,0 +1,71 @@
+from .monero_subaddress import MoneroSubaddress
+from .monero_wallet import MoneroWallet
+
+
+class MoneroSubaddressLookup:
+    """
+    Local address to subaddress index table of a wallet.
+
+    Subaddresses are keyed by their spend public key in a flat open addressing table, which costs
+    about 56 bytes per subaddress. Lookups are resolved in memory without querying the wallet. Subaddresses created outside of
+    the table must be added with `add_subaddresses()` or picked up with `refresh()`.
+    """
+
+    def __init__(self, wallet: MoneroWallet) -> None:
+        """
+        Initialize a lookup table with all subaddresses of the given wallet.
+
+        :param MoneroWallet wallet: wallet to index subaddresses of.
+        """
+        ...
+    def __contains__(self, address: str) -> bool:
+        """
+        Indicates if the address is in the table.
+
+        :param str address: address to look up.
+        :returns bool: `True` if the address is in the table, `False` otherwise.
+        """
+        ...
+    def __len__(self) -> int:
+        """
+        Get the number of subaddresses in the table.
+
+        :returns int: number of subaddresses in the table.
+        """
+        ...
+    def add_subaddresses(self, subaddresses: list[MoneroSubaddress]) -> None:
+        """
+        Add subaddresses to the table.
+
+        :param list[MoneroSubaddress] subaddresses: subaddresses with address, account index and index.
+        """
+        ...
+    def create_subaddresses(self, account_idx: int, count: int, labels: list[str] = []) -> list[MoneroSubaddress]:
+        """
+        Create subaddresses in the wallet and add them to the table.
+
+        :param int account_idx: specifies the index of the account to create the subaddresses within.
+        :param int count: number of subaddresses to create.
+        :param list[str] labels: no label, one label for all subaddresses or one label per subaddress.
+        :returns list[MoneroSubaddress]: the created subaddresses.
+        """
+        ...
+    def get_capacity(self) -> int:
+        """
+        Get the number of slots allocated by the table.
+
+        :returns int: number of slots, a power of two kept at most 3/4 full.
+        """
+        ...
+    def get_address_index(self, address: str) -> MoneroSubaddress:
+        """
+        Get the account and subaddress index of the given address.
+
+        :param str address: is the address to get the account and subaddress index from.
+        :returns MoneroSubaddress: the account and subaddress indices.
+        :raise MoneroError: exception if address is invalid or not in the table.
+        """
+        ...
+    def refresh(self) -> None:
+        """Rebuild the table from the wallet's subaddresses."""
+        ...
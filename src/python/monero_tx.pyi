@@ -1,6 +1,7 @@
 from .serializable_struct import SerializableStruct
 from .monero_block import MoneroBlock
 from .monero_output import MoneroOutput
+from .monero_hash32 import MoneroHash32
 
 
 class MoneroTx(SerializableStruct):
@@ -94,6 +95,13 @@ class MoneroTx(SerializableStruct):
         :returns MoneroTx: tx copy.
         """
         ...
+    def get_hash32(self) -> MoneroHash32 | None:
+        """
+        Get the transaction hash as a 32-byte hash.
+
+        :returns MoneroHash32 | None: The hash of the transaction, if known.
+        """
+        ...
     def get_height(self) -> int | None:
         """
         Get the transaction height.
@@ -0,0 +1,14 @@
+from .monero_tx_wallet import MoneroTxWallet
+
+
+class MoneroTxBatchResult:
+    """Models the result of creating transactions for many configs."""
+
+    txs: list[list[MoneroTxWallet]]
+    """Transactions created for each config, empty if the config failed."""
+    errors: list[str | None]
+    """Error of each config, `None` if the config succeeded."""
+
+    def __init__(self) -> None:
+        """Initialize a tx batch result."""
+        ...
@@ -0,0 +1,14 @@
+from .monero_tx_set import MoneroTxSet
+
+
+class MoneroTxSetBatchResult:
+    """Models the result of signing many unsigned tx sets."""
+
+    tx_sets: list[MoneroTxSet]
+    """Signed tx set of each unsigned tx set, empty if signing failed."""
+    errors: list[str | None]
+    """Error of each unsigned tx set, `None` if it was signed."""
+
+    def __init__(self) -> None:
+        """Initialize a tx set batch result."""
+        ...
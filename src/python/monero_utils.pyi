@@ -233,6 +233,20 @@ class MoneroUtils:
         """
         ...
 
+    @staticmethod
+    def merge_txs(txs: list[MoneroTxWallet], other_txs: list[MoneroTxWallet]) -> list[MoneroTxWallet]:
+        """
+        Merge two lists of transactions by hash.
+
+        Transactions with the same hash are merged into the first occurrence, which is updated in place.
+        Transactions without a hash are kept as they are.
+
+        :param list[MoneroTxWallet] txs: first transactions to merge.
+        :param list[MoneroTxWallet] other_txs: second transactions to merge.
+        :returns list[MoneroTxWallet]: union of the transactions, sorted by height.
+        """
+        ...
+
     @staticmethod
     def set_log_level(loglevel: int) -> None:
         """
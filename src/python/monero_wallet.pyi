@@ -1,6 +1,8 @@
 import typing
+import asyncio
 
 from .monero_wallet_listener import MoneroWalletListener
+from .monero_check_batch_result import MoneroCheckBatchResult
 from .monero_check_reserve import MoneroCheckReserve
 from .monero_check_tx import MoneroCheckTx
 from .monero_account import MoneroAccount
@@ -17,11 +19,15 @@ from .monero_integrated_address import MoneroIntegratedAddress
 from .monero_key_image_export_result import MoneroKeyImageExportResult
 from .monero_key_image_import_result import MoneroKeyImageImportResult
 from .monero_tx_set import MoneroTxSet
+from .monero_tx_batch_result import MoneroTxBatchResult
+from .monero_tx_set_batch_result import MoneroTxSetBatchResult
+from .monero_message_batch_result import MoneroMessageBatchResult
 from .monero_multisig_init_result import MoneroMultisigInitResult
 from .monero_key_image import MoneroKeyImage
 from .monero_multisig_info import MoneroMultisigInfo
 from .monero_network_type import MoneroNetworkType
 from .monero_output_wallet import MoneroOutputWallet
+from .monero_output_columns import MoneroOutputColumns
 from .monero_output_query import MoneroOutputQuery
 from .monero_transfer import MoneroTransfer
 from .monero_transfer_query import MoneroTransferQuery
@@ -77,6 +83,19 @@ class MoneroWallet:
         :returns MoneroCheckReserve: the result of checking the signature proof.
         """
         ...
+    def check_reserve_proofs(self, checks: list[tuple[str, str, str]], num_threads: int = 0) -> MoneroCheckBatchResult:
+        """
+        Check many reserve proofs.
+
+        Checks run concurrently on in-memory clones of a full wallet, other wallets run them one
+        after another. A proof which does not verify is a check which is not good, a check which
+        cannot be performed, e.g. for an unknown tx or an unreachable daemon, reports its error.
+
+        :param list[tuple[str, str, str]] checks: (address, message, signature) of each proof.
+        :param int num_threads: maximum number of concurrent checks (default = thread pool size + 1).
+        :returns MoneroCheckBatchResult: the `MoneroCheckReserve` or error of each check, in order.
+        """
+        ...
     def check_spend_proof(self, tx_hash: str, message: str, signature: str) -> bool:
         """
         Prove a spend using a signature. Unlike proving a transaction, it does not require the destination public address.
@@ -87,6 +106,19 @@ class MoneroWallet:
         :returns bool: `True` if the signature is good, `False` otherwise.
         """
         ...
+    def check_spend_proofs(self, checks: list[tuple[str, str, str]], num_threads: int = 0) -> MoneroCheckBatchResult:
+        """
+        Check many spend proofs.
+
+        Checks run concurrently on in-memory clones of a full wallet, other wallets run them one
+        after another. A proof which does not verify is a check which is not good, a check which
+        cannot be performed, e.g. for an unknown tx or an unreachable daemon, reports its error.
+
+        :param list[tuple[str, str, str]] checks: (tx hash, message, signature) of each proof.
+        :param int num_threads: maximum number of concurrent checks (default = thread pool size + 1).
+        :returns MoneroCheckBatchResult: the `MoneroCheck` or error of each check, in order.
+        """
+        ...
     def check_tx_key(self, tx_hash: str, tx_key: str, address: str) -> MoneroCheckTx:
         """
         Check a transaction in the blockchain with its secret key.
@@ -97,6 +129,19 @@ class MoneroWallet:
         :returns MoneroCheckTx: the result of the check.
         """
         ...
+    def check_tx_keys(self, checks: list[tuple[str, str, str]], num_threads: int = 0) -> MoneroCheckBatchResult:
+        """
+        Check many transactions in the blockchain with their secret keys.
+
+        Checks run concurrently on in-memory clones of a full wallet, other wallets run them one
+        after another. A proof which does not verify is a check which is not good, a check which
+        cannot be performed, e.g. for an unknown tx or an unreachable daemon, reports its error.
+
+        :param list[tuple[str, str, str]] checks: (tx hash, tx key, address) of each check.
+        :param int num_threads: maximum number of concurrent checks (default = thread pool size + 1).
+        :returns MoneroCheckBatchResult: the `MoneroCheckTx` or error of each check, in order.
+        """
+        ...
     def check_tx_proof(self, tx_hash: str, address: str, message: str, signature: str) -> MoneroCheckTx:
         """
         Prove a transaction by checking its signature.
@@ -108,6 +153,19 @@ class MoneroWallet:
         :returns MoneroCheckTx: the result of the check.
         """
         ...
+    def check_tx_proofs(self, checks: list[tuple[str, str, str, str]], num_threads: int = 0) -> MoneroCheckBatchResult:
+        """
+        Check many transaction proofs.
+
+        Checks run concurrently on in-memory clones of a full wallet, other wallets run them one
+        after another. A proof which does not verify is a check which is not good, a check which
+        cannot be performed, e.g. for an unknown tx or an unreachable daemon, reports its error.
+
+        :param list[tuple[str, str, str, str]] checks: (tx hash, address, message, signature) of each proof.
+        :param int num_threads: maximum number of concurrent checks (default = thread pool size + 1).
+        :returns MoneroCheckBatchResult: the `MoneroCheckTx` or error of each check, in order.
+        """
+        ...
     def close(self, save: bool = False) -> None:
         """
         Optionally save then close the wallet.
@@ -133,6 +191,16 @@ class MoneroWallet:
         :returns MoneroSubaddress: the created subaddress.
         """
         ...
+    def create_subaddresses(self, account_idx: int, count: int, labels: list[str] = []) -> list[MoneroSubaddress]:
+        """
+        Create many subaddresses within an account in one call.
+
+        :param int account_idx: specifies the index of the account to create the subaddresses within.
+        :param int count: number of subaddresses to create.
+        :param list[str] labels: no label, one label for all subaddresses or one label per subaddress.
+        :returns list[MoneroSubaddress]: the created subaddresses.
+        """
+        ...
     def create_tx(self, config: MoneroTxConfig) -> MoneroTxWallet:
         """
         Create a transaction to transfer funds from this wallet.
@@ -141,6 +209,14 @@ class MoneroWallet:
         :returns MoneroTxWallet: the created transaction.
         """
         ...
+    def create_tx_async(self, config: MoneroTxConfig) -> asyncio.Future[MoneroTxWallet]:
+        """
+        Create a transaction to transfer funds from this wallet on the library thread pool.
+
+        :param MoneroTxConfig config: configures the transaction to create.
+        :returns asyncio.Future[MoneroTxWallet]: future of the created transaction.
+        """
+        ...
     def create_txs(self, config: MoneroTxConfig) -> list[MoneroTxWallet]:
         """
         Create one or more transactions to transfer funds from this wallet.
@@ -149,6 +225,26 @@ class MoneroWallet:
         :returns list[MoneroTxWallet]: the created transactions.
         """
         ...
+    def create_txs_batch(self, configs: list[MoneroTxConfig]) -> MoneroTxBatchResult:
+        """
+        Create the transactions of many independent configs in one call.
+
+        Inputs selected for a config are frozen until the batch is done, so later configs
+        do not select the same inputs. Outputs frozen by the batch are thawed before returning,
+        also on error.
+
+        :param list[MoneroTxConfig] configs: configures the transactions to create.
+        :returns MoneroTxBatchResult: the created transactions and error of each config.
+        """
+        ...
+    def create_txs_async(self, config: MoneroTxConfig) -> asyncio.Future[list[MoneroTxWallet]]:
+        """
+        Create one or more transactions to transfer funds from this wallet on the library thread pool.
+
+        :param MoneroTxConfig config: configures the transactions to create.
+        :returns asyncio.Future[list[MoneroTxWallet]]: future of the created transactions.
+        """
+        ...
     def decode_integrated_address(self, integrated_address: str) -> MoneroIntegratedAddress:
         """
         Decode an integrated address to get its standard address and payment id.
@@ -235,6 +331,26 @@ class MoneroWallet:
         :returns str: outputs in hex format, empty string if no outputs.
         """
         ...
+    def export_outputs_bytes(self, all: bool = False) -> bytes:
+        """
+        Export outputs in binary format, half the size of the hex format.
+
+        :param bool all: export all outputs if `True`, else export outputs since the last export.
+        :returns bytes: outputs in binary format, empty if no outputs.
+        """
+        ...
+    def export_outputs_to(self, stream: typing.BinaryIO, all: bool = False, chunk_size: int = 65536) -> int:
+        """
+        Export outputs in binary format to a writable binary stream, one chunk at a time.
+
+        Wrap the stream (e.g. with `gzip.GzipFile`) to compress the export.
+
+        :param BinaryIO stream: stream the outputs are written to.
+        :param bool all: export all outputs if `True`, else export outputs since the last export.
+        :param int chunk_size: maximum number of bytes passed to each `write()` call (default 65536).
+        :returns int: number of bytes written.
+        """
+        ...
     def freeze_output(self, key_image: str) -> None:
         """
         Freeze an output.
@@ -376,6 +492,13 @@ class MoneroWallet:
         :returns int: the subaddress's balance.
         """
         ...
+    def get_balances(self) -> dict[tuple[int, int], tuple[int, int]]:
+        """
+        Get the balance and unlocked balance of every subaddress in one call.
+
+        :returns dict[tuple[int, int], tuple[int, int]]: (balance, unlocked balance) keyed by (account index, subaddress index).
+        """
+        ...
     def get_daemon_connection(self) -> MoneroRpcConnection | None:
         """
         Get the wallet's daemon connection.
@@ -483,6 +606,25 @@ class MoneroWallet:
         :returns list[MoneroOutputWallet]: wallet outputs per the query.
         """
         ...
+    def get_outputs_columns(self, query: MoneroOutputQuery | None = None) -> MoneroOutputColumns:
+        """
+        Get outputs which meet the criteria defined in a query as contiguous columns.
+
+        Skips creating a python object per output, which makes it suitable for analysing
+        very large output sets (e.g. with NumPy).
+
+        :param MoneroOutputQuery | None query: specifies query options (optional).
+        :returns MoneroOutputColumns: amount, key image, indices, flags and height of each output.
+        """
+        ...
+    def get_outputs_async(self, query: MoneroOutputQuery | None = None) -> asyncio.Future[list[MoneroOutputWallet]]:
+        """
+        Get outputs which meet the criteria defined in a query on the library thread pool.
+
+        :param MoneroOutputQuery | None query: specifies query options (optional).
+        :returns asyncio.Future[list[MoneroOutputWallet]]: future of the wallet outputs per the query.
+        """
+        ...
     def get_path(self) -> str:
         """
         Get the path of this wallet's file on disk.
@@ -685,6 +827,14 @@ class MoneroWallet:
         :returns list[MoneroTransfer]: transfers to/from the accsubaddressount.
         """
         ...
+    def get_transfers_async(self, query: MoneroTransferQuery | None = None) -> asyncio.Future[list[MoneroTransfer]]:
+        """
+        Get incoming and outgoing transfers to and from this wallet on the library thread pool.
+
+        :param MoneroTransferQuery | None query: configures the query (optional).
+        :returns asyncio.Future[list[MoneroTransfer]]: future of the wallet transfers per the query.
+        """
+        ...
     def get_tx_key(self, tx_hash: str) -> str:
         """
         Get a transaction's secret key from its hash.
@@ -761,6 +911,14 @@ class MoneroWallet:
         :returns list[MoneroTxWallet]: wallet transactions per the query.
         """
         ...
+    def get_txs_async(self, query: MoneroTxQuery | None = None) -> asyncio.Future[list[MoneroTxWallet]]:
+        """
+        Get wallet transactions on the library thread pool.
+
+        :param MoneroTxQuery | None query: specifies properties of the transactions to get (optional).
+        :returns asyncio.Future[list[MoneroTxWallet]]: future of the wallet transactions per the query.
+        """
+        ...
     @typing.overload
     def get_unlocked_balance(self) -> int:
         """
@@ -805,6 +963,20 @@ class MoneroWallet:
         :returns MoneroKeyImageImportResult: results of the import.
         """
         ...
+    def import_key_images_chunked(self, key_images: typing.Iterable[MoneroKeyImage], chunk_size: int = 1000, offset: int = 0, progress: typing.Callable[[int], None] | None = None) -> MoneroKeyImageImportResult:
+        """
+        Import signed key images in chunks pulled from an iterable, so only one chunk is held in memory at a time.
+
+        Each chunk is imported at its own offset among the wallet's outputs. An interrupted import
+        can be resumed by passing the last offset reported to `progress` and the remaining key images.
+
+        :param Iterable[MoneroKeyImage] key_images: key images to import and verify (requires hex and signature).
+        :param int chunk_size: maximum number of key images imported at once (default 1000).
+        :param int offset: offset of the first key image among the wallet's outputs.
+        :param Callable[[int], None] | None progress: called after each chunk with the offset of the next key image to import.
+        :returns MoneroKeyImageImportResult: combined results of the import.
+        """
+        ...
     def import_multisig_hex(self, multisig_hexes: list[str], refresh_after_import: bool = True) -> int:
         """
         Import multisig info as hex from other participants.
@@ -825,6 +997,30 @@ class MoneroWallet:
         :returns int: the number of outputs imported.
         """
         ...
+    def import_outputs_bytes(self, outputs: bytes | bytearray | memoryview) -> int:
+        """
+        Import outputs in binary format.
+
+        The buffer is hex encoded for the wallet without holding the GIL, so it must not be
+        modified from another thread during the call.
+
+        :param bytes | bytearray | memoryview outputs: are outputs in binary format.
+        :returns int: the number of outputs imported.
+        """
+        ...
+    def import_outputs_from(self, stream: typing.BinaryIO, chunk_size: int = 65536) -> int:
+        """
+        Import outputs in binary format read from a binary stream, one chunk at a time.
+
+        Wrap the stream (e.g. with `gzip.GzipFile`) to import a compressed export. The import is not
+        streamed end to end: the wallet imports from one hex string, so the whole export is held in
+        memory in hex format, twice its binary size, before it is imported.
+
+        :param BinaryIO stream: stream the outputs are read from until exhausted.
+        :param int chunk_size: maximum number of bytes requested by each `read()` call (default 65536).
+        :returns int: the number of outputs imported.
+        """
+        ...
     def is_closed(self) -> bool:
         """
         Indicates if the wallet is closed.
@@ -969,6 +1165,16 @@ class MoneroWallet:
         tx notes, etc.
         """
         ...
+    def rescan_blockchain_async(self) -> asyncio.Future[None]:
+        """
+        Rescan the blockchain from scratch on the library thread pool.
+
+        Cancelling the future interrupts only this rescan; background syncing started with
+        `start_syncing()` resumes afterwards.
+
+        :returns asyncio.Future[None]: future completed when the rescan is done.
+        """
+        ...
     def rescan_spent(self) -> None:
         """
         Rescan the blockchain for spent outputs.
@@ -981,7 +1187,22 @@ class MoneroWallet:
         """
         ...
     def save(self) -> None:
-        """Save the wallet at its current path."""
+        """
+        Save the wallet at its current path.
+
+        Note: the full wallet rewrites its whole encrypted cache file on each save, so the save time
+        grows with the wallet history rather than with the changes since the last save.
+        """
+        ...
+    def save_async(self) -> asyncio.Future[None]:
+        """
+        Save the wallet at its current path on the library thread pool.
+
+        The calling thread is not blocked while the wallet is written. Saves of the same wallet,
+        including `save()` and `close(True)`, are serialized; saves of different wallets run concurrently.
+
+        :returns asyncio.Future[None]: future completed when the wallet is saved.
+        """
         ...
     def scan_txs(self, tx_hashes: list[str]) -> None:
         """
@@ -1094,6 +1315,18 @@ class MoneroWallet:
         :returns MoneroTxSet: the signed transaction set.
         """
         ...
+    def sign_txs_batch(self, unsigned_tx_hexes: list[str]) -> MoneroTxSetBatchResult:
+        """
+        Sign many unsigned transaction sets from view-only wallets.
+
+        The sets are signed one after another by this wallet in a single call without the GIL, so the
+        outputs each set carries are imported into this wallet as with `sign_txs()`. A set which cannot
+        be signed does not fail the others.
+
+        :param list[str] unsigned_tx_hexes: unsigned transaction hexes from when the transactions were created.
+        :returns MoneroTxSetBatchResult: the signed transaction set and error of each unsigned set, in order.
+        """
+        ...
     def start_syncing(self, sync_period_in_ms: int = 10000) -> None:
         """
         Start background synchronizing with a maximum period between syncs.
@@ -1195,6 +1428,19 @@ class MoneroWallet:
         :returns MoneroSyncResult: the sync result.
         """
         ...
+    def sync_async(self, start_height: int | None = None, listener: MoneroWalletListener | None = None) -> asyncio.Future[MoneroSyncResult]:
+        """
+        Synchronize the wallet with the daemon on the library thread pool.
+
+        Must be called from a running event loop. Cancelling the future interrupts only the
+        synchronization started by this call; background syncing started with `start_syncing()`
+        resumes afterwards. Futures still pending when the thread pool shuts down are cancelled.
+
+        :param int | None start_height: start height to sync from (optional).
+        :param MoneroWalletListener | None listener: listener to receive notifications during synchronization (optional).
+        :returns asyncio.Future[MoneroSyncResult]: future of the sync result.
+        """
+        ...
     def tag_accounts(self, tag: str, account_indices: list[int]) -> None:
         """
         Tag accounts.
@@ -1227,6 +1473,20 @@ class MoneroWallet:
         :returns MoneroMessageSignatureResult: the message signature result.
         """
         ...
+    def verify_messages(self, messages: list[tuple[str, str, str]], num_threads: int = 0) -> MoneroMessageBatchResult:
+        """
+        Verify many message signatures.
+
+        A full wallet decodes each distinct standard address once and verifies the signatures
+        concurrently on the library thread pool, without touching the wallet's own state. Other
+        wallets verify them one after another. A signature which does not match is a result which
+        is not good, a signature which cannot be verified, e.g. for an invalid address, reports its error.
+
+        :param list[tuple[str, str, str]] messages: (message, signing address, signature) of each signature.
+        :param int num_threads: maximum number of concurrent verifications (default = thread pool size + 1).
+        :returns MoneroMessageBatchResult: the result or error of each verification, in order.
+        """
+        ...
     def wait_for_next_block(self) -> int:
         """
         Wait for the next block to be added to the chain.
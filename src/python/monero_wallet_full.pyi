@@ -2,6 +2,8 @@ from .monero_wallet import MoneroWallet
 from .monero_wallet_config import MoneroWalletConfig
 from .monero_network_type import MoneroNetworkType
 from .monero_rpc_connection import MoneroRpcConnection
+from .monero_partition_scan_listener import MoneroPartitionScanListener
+from .monero_partition_scan_result import MoneroPartitionScanResult
 
 
 class MoneroWalletFull(MoneroWallet):
@@ -40,14 +42,14 @@ class MoneroWalletFull(MoneroWallet):
         ...
 
     @staticmethod
-    def open_wallet_data(password: str, nettype: MoneroNetworkType, keys_data: str, cache_data: str, daemon_connection: MoneroRpcConnection = MoneroRpcConnection(), regtest: bool = False) -> MoneroWalletFull:
+    def open_wallet_data(password: str, nettype: MoneroNetworkType, keys_data: bytes | bytearray | memoryview, cache_data: bytes | bytearray | memoryview, daemon_connection: MoneroRpcConnection = MoneroRpcConnection(), regtest: bool = False) -> MoneroWalletFull:
         """
         Open an in-memory wallet from existing data buffers.
 
         :param str password: is the password of the wallet file to open.
         :param MoneroNetworkType nettype: is the wallet's network type.
-        :param str keys_data: contains the contents of the ".keys" file.
-        :param str cache_data: contains the contents of the wallet cache file (no extension).
+        :param bytes keys_data: contains the contents of the ".keys" file (any contiguous buffer).
+        :param bytes cache_data: contains the contents of the wallet cache file (no extension, any contiguous buffer).
         :param MoneroRpcConnection daemon_connection: is connection information to a daemon (default = an unconnected wallet).
         :param bool regtest: indicates if wallet to open is a regtest wallet (optional).
         :returns MoneroWalletFull: reference to the wallet instance.
@@ -64,20 +66,42 @@ class MoneroWalletFull(MoneroWallet):
         """
         ...
 
-    def get_cache_file_buffer(self) -> str:
+    def get_cache_file_buffer(self) -> bytes:
         """
         Get wallet cache file without using filesystem.
 
-        :returns str: Cache file buffer.
+        :returns bytes: Cache file buffer.
         """
         ...
 
-    def get_keys_file_buffer(self, password: str, view_only: bool) -> str:
+    def get_keys_file_buffer(self, password: str, view_only: bool) -> bytes:
         """
         Get wallet keys file without using filesystem.
 
         :param str password: The wallet password.
         :param bool view_only: Get view-only keys.
-        :returns str: Keys file buffer.
+        :returns bytes: Keys file buffer.
+        """
+        ...
+
+    def scan_partitioned(self, start_height: int, end_height: int | None = None, num_partitions: int = 0, listener: MoneroPartitionScanListener | None = None) -> MoneroPartitionScanResult:
+        """
+        Scan a height range of the blockchain for the wallet's transactions by splitting it into
+        partitions which are scanned concurrently by in-memory wallets created from the wallet's keys.
+
+        Found transactions and outputs are merged in height order, then the spent status of the outputs
+        is computed from their key images in a final pass (skipped for view-only wallets). Only spends
+        confirmed in the blockchain mark an output as spent.
+
+        Note: this is a read-only scan which returns a report; the wallet's own state is never modified.
+        Each partition only sees its own blocks, so outgoing transactions which spend outputs received
+        in an earlier partition are not found and the returned history is incomplete. Use `sync()` or
+        `rescan_blockchain()` to restore a wallet.
+
+        :param int start_height: first height to scan.
+        :param int | None end_height: height to stop before (default = daemon height).
+        :param int num_partitions: number of partitions (default = number of hardware threads).
+        :param MoneroPartitionScanListener | None listener: listener to receive per-partition progress (optional).
+        :returns MoneroPartitionScanResult: the transactions and outputs found.
         """
         ...
@@ -1,11 +1,18 @@
 import pytest
 import logging
 
+from array import array
 from json import loads
+from pickle import dumps, loads as unpickle
+from time import perf_counter
 
 from monero import (
     SerializableStruct, SslOptions,
-    MoneroError, MoneroRpcError
+    MoneroError, MoneroRpcError,
+    MoneroBlock, MoneroTx, MoneroTxWallet, MoneroOutputWallet,
+    MoneroIncomingTransfer, MoneroOutgoingTransfer, MoneroHash32, MoneroKeyImage, MoneroTxQuery, MoneroTransferQuery,
+    VectorMoneroBlock, VectorMoneroTxWallet, VectorMoneroIncomingTransfer, VectorMoneroTransfer,
+    VectorInt, VectorUint8, VectorUint32, VectorUint64, VectorString # type: ignore
 )
 
 from utils import BaseTestClass
@@ -55,3 +62,367 @@ class TestMoneroCommon(BaseTestClass):
 
         for i, allowed_fingerprint in enumerate(allowed_fingerprints):
             assert allowed_fingerprint == ssl_options.ssl_allowed_fingerprints[i]
+
+    # test bulk serialization of vectors
+    def test_serialize_many(self) -> None:
+        blocks = VectorMoneroBlock()
+        for height in range(3):
+            block = MoneroBlock()
+            block.height = height
+            block.timestamp = 1000 + height
+            blocks.append(block)
+
+        data: bytes = blocks.serialize_many()
+        assert isinstance(data, bytes)
+        assert loads(data) == [loads(block.serialize()) for block in blocks]
+        assert loads(VectorMoneroBlock().serialize_many()) == []
+
+    # test bulk deserialization of vectors
+    def test_deserialize_many(self) -> None:
+        blocks = VectorMoneroBlock()
+        for height in range(3):
+            block = MoneroBlock()
+            block.height = height
+            block.hash = f"{height:064x}"
+            tx = MoneroTx()
+            tx.hash = f"{height + 100:064x}"
+            tx.fee = 1000 * height
+            tx.is_confirmed = True
+            block.txs.append(tx)
+            blocks.append(block)
+
+        data: bytes = blocks.serialize_many()
+        restored = VectorMoneroBlock.deserialize_many(data)
+        assert len(restored) == len(blocks)
+        assert loads(restored.serialize_many()) == loads(data)
+
+        # backlinks are rebuilt from the json nesting
+        for block in restored:
+            assert len(block.txs) == 1
+            tx_block = block.txs[0].block
+            assert tx_block is not None
+            assert tx_block.hash == block.hash
+
+        # arena allocated graphs are equivalent and outlive the vector they were returned in
+        arena_blocks = VectorMoneroBlock.deserialize_many(data, use_arena=True)
+        assert loads(arena_blocks.serialize_many()) == loads(data)
+        arena_tx = arena_blocks[2].txs[0]
+        del arena_blocks
+        assert arena_tx.fee == 2000
+        assert arena_tx.block is not None and arena_tx.block.height == 2
+
+        # invalid json is rejected
+        try:
+            VectorMoneroBlock.deserialize_many(b"{}")
+            raise Exception("Should have failed")
+        except MoneroError as e:
+            assert "Expected json array" in str(e)
+
+    # test bulk deserialization of standalone txs and transfers
+    def test_deserialize_many_standalone(self) -> None:
+        # txs of one block and an unconfirmed tx
+        block = MoneroBlock()
+        block.height = 7
+        block.hash = f"{7:064x}"
+        txs = VectorMoneroTxWallet()
+        for i in range(3):
+            tx = MoneroTxWallet()
+            tx.hash = f"{i:064x}"
+            tx.is_incoming = True
+            if i < 2:
+                tx.block = block
+                block.txs.append(tx)
+            txs.append(tx)
+
+        # the block header is serialized with each tx so the height survives a round trip
+        data: bytes = txs.serialize_many()
+        assert loads(data)[0]["block"]["height"] == 7
+        assert "block" not in loads(data)[2]
+        restored = VectorMoneroTxWallet.deserialize_many(data)
+        assert loads(restored.serialize_many()) == loads(data)
+        assert restored[0].get_height() == 7
+        assert restored[1].get_height() == 7
+        assert restored[2].get_height() is None
+        tx_block = restored[0].block
+        assert tx_block is not None
+        assert tx_block.hash == block.hash
+        assert len(tx_block.txs) == 2
+
+        # transfers are typed explicitly, not guessed from their fields
+        transfers = VectorMoneroTransfer()
+        incoming = MoneroIncomingTransfer()
+        incoming.amount = 10
+        incoming.account_index = 0
+        transfers.append(incoming)
+        outgoing = MoneroOutgoingTransfer()
+        outgoing.amount = 20
+        outgoing.account_index = 0
+        transfers.append(outgoing)
+        data = transfers.serialize_many()
+        assert [transfer["type"] for transfer in loads(data)] == ["incoming", "outgoing"]
+        restored_transfers = VectorMoneroTransfer.deserialize_many(data)
+        assert isinstance(restored_transfers[0], MoneroIncomingTransfer)
+        assert isinstance(restored_transfers[1], MoneroOutgoingTransfer)
+        assert loads(restored_transfers.serialize_many()) == loads(data)
+
+        # untyped transfers are rejected
+        try:
+            VectorMoneroTransfer.deserialize_many(b'[{"amount": 10}]')
+            raise Exception("Should have failed")
+        except MoneroError as e:
+            assert "transfer type" in str(e)
+
+    # test pickling of model graphs
+    def test_pickle(self) -> None:
+        block = MoneroBlock()
+        block.height = 10
+        block.hash = f"{10:064x}"
+        for i in range(2):
+            tx = MoneroTxWallet()
+            tx.hash = f"{i:064x}"
+            tx.is_incoming = True
+            tx.block = block
+            transfer = MoneroIncomingTransfer()
+            transfer.amount = 1000 + i
+            transfer.subaddress_index = i
+            transfer.tx = tx
+            tx.incoming_transfers.append(transfer)
+            output = MoneroOutputWallet()
+            output.amount = 1000 + i
+            output.tx = tx
+            tx.outputs.append(output)
+            block.txs.append(tx)
+
+        # pickled objects keep their type and graph
+        tx = block.txs[1]
+        restored_tx = unpickle(dumps(tx))
+        assert isinstance(restored_tx, MoneroTxWallet)
+        assert restored_tx.hash == tx.hash
+        assert restored_tx.get_height() == 10
+        assert restored_tx.block.txs[1] is restored_tx
+        restored_transfer = unpickle(dumps(tx.incoming_transfers[0]))
+        assert isinstance(restored_transfer, MoneroIncomingTransfer)
+        assert restored_transfer.amount == 1001
+        assert restored_transfer.tx.incoming_transfers[0] is restored_transfer
+        restored_output = unpickle(dumps(tx.outputs[0]))
+        assert isinstance(restored_output, MoneroOutputWallet)
+        assert restored_output.tx.outputs[0] is restored_output
+        restored_block = unpickle(dumps(block))
+        assert loads(restored_block.serialize()) == loads(block.serialize())
+
+        # pickled vectors share graphs between their elements
+        txs = VectorMoneroTxWallet()
+        for block_tx in block.txs:
+            txs.append(block_tx)
+        restored_txs = unpickle(dumps(txs))
+        assert len(restored_txs) == 2
+        assert restored_txs[0].block is restored_txs[1].block
+        assert restored_txs[0].block.txs[0] is restored_txs[0]
+        assert [t.hash for t in restored_txs] == [t.hash for t in txs]
+
+    # test fixed-size hashes
+    def test_hash32(self) -> None:
+        hex_hash = "ab" * 32
+        hash32 = MoneroHash32(hex_hash)
+        assert hash32.hex() == hex_hash
+        assert str(hash32) == hex_hash
+        assert bytes(hash32) == bytes.fromhex(hex_hash)
+        assert memoryview(hash32).nbytes == 32
+        assert MoneroHash32.from_bytes(bytes(hash32)) == hash32
+        assert MoneroHash32() != hash32
+        assert MoneroHash32() < hash32
+        assert len({hash32, MoneroHash32(hex_hash), MoneroHash32()}) == 2
+
+        # model accessors
+        tx = MoneroTx()
+        assert tx.get_hash32() is None
+        tx.hash = hex_hash
+        assert tx.get_hash32() == hash32
+        block = MoneroBlock()
+        block.hash = hex_hash
+        assert block.get_hash32() == hash32
+        key_image = MoneroKeyImage()
+        key_image.hex = hex_hash
+        assert key_image.get_hex32() == hash32
+
+        # invalid hex is rejected
+        for invalid_hex in ["ab", "zz" * 32]:
+            try:
+                MoneroHash32(invalid_hex)
+                raise Exception("Should have failed")
+            except MoneroError:
+                pass
+
+    # test buffer protocol of primitive vectors
+    def test_primitive_vector_buffers(self) -> None:
+        values = [0, 1, 2, 255]
+        for vector_type, typecode in [(VectorInt, "i"), (VectorUint8, "B"), (VectorUint32, "I"), (VectorUint64, "Q")]:
+            # construct from buffers of the same, a wider and a narrower item type
+            for source_typecode in [typecode, "q", "B"]:
+                vector = vector_type(array(source_typecode, values))
+                assert list(vector) == values
+
+            # export the buffer without copying
+            view = memoryview(vector)
+            assert view.itemsize == array(typecode).itemsize
+            assert view.tolist() == values
+
+            # round trip through the buffer protocol
+            assert list(vector_type(view)) == values
+
+        # strided buffers are supported
+        assert list(VectorUint64(memoryview(array("Q", [1, 2, 3, 4]))[::2])) == [1, 3]
+
+        # out of range values and non-integer buffers are rejected
+        for invalid in [array("q", [-1]), array("d", [1.0])]:
+            try:
+                VectorUint64(invalid)
+                raise Exception("Should have failed")
+            except MoneroError:
+                pass
+
+    # test conversion of list, tuple, iterable and array arguments
+    def test_vector_conversion(self) -> None:
+        hashes = [f"{i:064x}" for i in range(100000)]
+        amounts = [i * 2**40 for i in range(100000)]
+
+        for vector_type, values in [(VectorString, hashes), (VectorUint64, amounts)]:
+            for source in [values, tuple(values), iter(values)]:
+                vector = vector_type(source)
+                assert list(vector) == values
+
+        # bytes are accepted as strings
+        assert list(VectorString([b"ab", "cd"])) == ["ab", "cd"]
+
+        # invalid items are rejected
+        for vector_type, invalid in [(VectorString, [1]), (VectorString, array("B", [1])), (VectorUint64, [-1]), (VectorUint64, (2**64,)), (VectorUint64, ["1"])]:
+            try:
+                vector_type(invalid)
+                raise Exception("Should have failed")
+            except (TypeError, RuntimeError):
+                pass
+
+        # fixed-width bytes and unicode arrays are read from their buffers
+        np = pytest.importorskip("numpy")
+        assert list(VectorString(np.array(hashes[:3], dtype="S"))) == hashes[:3]
+        assert list(VectorString(np.array(["ab", "\u00e9", ""]))) == ["ab", "\u00e9", ""]
+        assert list(VectorString(np.array(hashes[:6], dtype="S")[::2])) == hashes[:6:2]
+
+    # test columnar projections of model vectors
+    def test_columns(self) -> None:
+        block = MoneroBlock()
+        block.height = 100
+        txs = VectorMoneroTxWallet()
+        transfers = VectorMoneroIncomingTransfer()
+        for i in range(3):
+            tx = MoneroTxWallet()
+            tx.hash = f"{i:064x}"
+            tx.is_incoming = i != 1
+            if i != 2:
+                tx.fee = 1000 * i
+                tx.block = block
+            transfer = MoneroIncomingTransfer()
+            transfer.amount = 10 + i
+            transfer.subaddress_index = i
+            transfer.tx = tx
+            tx.incoming_transfers.append(transfer)
+            txs.append(tx)
+            transfers.append(transfer)
+
+        # project any scalar field to a list
+        assert txs.column("hash") == [f"{i:064x}" for i in range(3)]
+        assert txs.column("height") == [100, 100, None]
+        assert txs.column("is_incoming") == [True, False, True]
+        assert txs.column("note") == [None, None, None]
+        assert transfers.column("amount") == [10, 11, 12]
+        assert transfers.column("tx_hash") == txs.column("hash")
+
+        # project integer and bool fields to a buffer
+        fees = txs.column_uint64("fee", 2**64 - 1)
+        assert memoryview(fees).tolist() == [0, 1000, 2**64 - 1]
+        assert list(transfers.column_uint64("subaddress_index")) == [0, 1, 2]
+        assert list(txs.column_uint64("is_incoming")) == [1, 0, 1]
+
+        assert "hash" in VectorMoneroTxWallet.column_names()
+        assert "amount" in VectorMoneroIncomingTransfer.column_names()
+
+        # unknown and non-integer columns are rejected
+        for project in [lambda: txs.column("unknown"), lambda: txs.column_uint64("hash")]:
+            try:
+                project()
+                raise Exception("Should have failed")
+            except MoneroError:
+                pass
+
+    # test native sorting and filtering of model vectors
+    def test_sort_and_filter(self) -> None:
+        txs = VectorMoneroTxWallet()
+        transfers = VectorMoneroIncomingTransfer()
+        for i in range(6):
+            tx = MoneroTxWallet()
+            tx.hash = f"{i:064x}"
+            tx.fee = (i % 3) * 100 if i != 5 else None
+            tx.is_incoming = i % 2 == 0
+            transfer = MoneroIncomingTransfer()
+            transfer.amount = i
+            transfer.subaddress_index = i % 2
+            transfer.tx = tx
+            tx.incoming_transfers.append(transfer)
+            txs.append(tx)
+            transfers.append(transfer)
+
+        # stable sort with unset values last
+        txs.sort_by(["fee"])
+        assert txs.column("hash") == [f"{i:064x}" for i in [0, 3, 1, 4, 2, 5]]
+
+        # multiple keys, descending with '-'
+        txs.sort_by(["-is_incoming", "-fee"])
+        assert txs.column("hash") == [f"{i:064x}" for i in [2, 4, 0, 1, 3, 5]]
+        transfers.sort_by(["subaddress_index", "-amount"])
+        assert transfers.column("amount") == [4, 2, 0, 5, 3, 1]
+
+        # parallel sort of large vectors matches a serial sort
+        many_txs = VectorMoneroTxWallet()
+        for i in range(70000):
+            tx = MoneroTxWallet()
+            tx.fee = (i * 7919) % 1000
+            tx.num_dummy_outputs = i
+            many_txs.append(tx)
+        many_txs.sort_by(["fee"], 4)
+        expected = sorted(range(70000), key=lambda i: (i * 7919) % 1000)
+        assert list(many_txs.column_uint64("num_dummy_outputs")) == expected
+
+        # filter with existing queries
+        tx_query = MoneroTxQuery()
+        tx_query.is_incoming = True
+        assert sorted(txs.filter(tx_query).column("hash")) == [f"{i:064x}" for i in [0, 2, 4]]
+        transfer_query = MoneroTransferQuery()
+        transfer_query.subaddress_index = 1
+        assert sorted(transfers.filter(transfer_query).column("amount")) == [1, 3, 5]
+
+        # unknown sort keys are rejected
+        try:
+            txs.sort_by(["unknown"])
+            raise Exception("Should have failed")
+        except MoneroError:
+            pass
+
+
+@pytest.mark.benchmark
+class TestMoneroCommonBenchmarks(BaseTestClass):
+    """Monero common benchmarks, opt-in with `pytest -m benchmark`."""
+
+    # benchmark conversion of list, tuple and iterable arguments
+    def test_vector_conversion_benchmark(self) -> None:
+        hashes = [f"{i:064x}" for i in range(100000)]
+        amounts = [i * 2**40 for i in range(100000)]
+
+        # timings are only logged, since they depend on the host
+        for vector_type, values in [(VectorString, hashes), (VectorUint64, amounts)]:
+            timings: dict[str, float] = {}
+            for name, source in [("list", values), ("tuple", tuple(values)), ("iterable", iter(values))]:
+                start = perf_counter()
+                vector = vector_type(source)
+                timings[name] = perf_counter() - start
+                assert len(vector) == len(values)
+            logger.info(f"{vector_type.__name__} conversion of {len(values)} items: " + ", ".join(f"{name} {seconds * 1000:.2f} ms" for name, seconds in timings.items()))
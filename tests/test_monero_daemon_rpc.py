@@ -1,5 +1,6 @@
 import pytest
 import time
+import asyncio
 import logging
 
 from typing import override
@@ -13,7 +14,7 @@ from monero import (
     MoneroTxPoolStats, MoneroBan, MoneroTxConfig, MoneroDestination,
     MoneroWalletRpc, MoneroKeyImageSpentStatus,
     MoneroOutputHistogramEntry, MoneroOutputDistributionEntry,
-    MoneroRpcConnection
+    MoneroRpcConnection, MoneroError
 )
 from utils import (
     TestUtils as Utils, TestContext,
@@ -106,6 +107,25 @@ class TestMoneroDaemonRpc(BaseTestClass):
         height = daemon.get_height()
         assert height > 0, "Height must be greater than 0"
 
+    # Can get the blockchain height and blocks from a running event loop
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_get_height_async(self, daemon: MoneroDaemonRpc) -> None:
+        async def get_last_block() -> tuple[int, MoneroBlock]:
+            height: int = await daemon.get_height_async()
+            block: MoneroBlock = await daemon.get_block_by_height_async(height - 1)
+            return height, block
+
+        height, block = asyncio.run(get_last_block())
+        assert height > 0, "Height must be greater than 0"
+        assert block.height == height - 1
+
+        # errors are raised by the awaited future
+        async def get_invalid_block() -> MoneroBlock:
+            return await daemon.get_block_by_height_async(height + 1000)
+
+        with pytest.raises(MoneroError):
+            asyncio.run(get_invalid_block())
+
     # Can get a block hash by height
     @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     def test_get_block_id_by_height(self, daemon: MoneroDaemonRpc) -> None:
@@ -7,6 +7,7 @@ from typing import Any
 from configparser import ConfigParser
 from monero import (
     MoneroNetworkType, MoneroIntegratedAddress, MoneroUtils, MoneroTxConfig,
+    MoneroTxWallet, MoneroBlock
 )
 from utils import AddressBook, KeysBook, WalletUtils, BaseTestClass, WalletErrorUtils
 
@@ -389,4 +390,33 @@ class TestMoneroUtils(BaseTestClass):
         # TODO why 12?
         assert size == 12
 
+    # Can merge txs by hash
+    def test_merge_txs(self) -> None:
+        def create_tx(hash_idx: int, height: int | None) -> MoneroTxWallet:
+            tx = MoneroTxWallet()
+            tx.hash = f"{hash_idx:064x}"
+            if height is not None:
+                block = MoneroBlock()
+                block.height = height
+                block.txs.append(tx)
+                tx.block = block
+                tx.is_confirmed = True
+            return tx
+
+        pool_tx = create_tx(0, None)
+        pool_tx.in_tx_pool = True
+        confirmed_txs = [create_tx(1, 20), create_tx(2, 10)]
+        wallet_tx = create_tx(2, 10)
+        wallet_tx.note = "wallet note"
+
+        merged = MoneroUtils.merge_txs(confirmed_txs, [wallet_tx, pool_tx])
+        assert [tx.hash for tx in merged] == [f"{2:064x}", f"{1:064x}", f"{0:064x}"]
+        # matching txs are merged into the first occurrence
+        assert merged[0] is confirmed_txs[1]
+        assert merged[0].note == "wallet note"
+        assert merged[2].in_tx_pool is True
+
+        # merging with nothing keeps every tx
+        assert len(MoneroUtils.merge_txs(confirmed_txs, [])) == 2
+
     #endregion
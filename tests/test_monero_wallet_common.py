@@ -4,6 +4,8 @@ import pytest
 import logging
 
 from typing import override
+from io import BytesIO
+from json import loads
 from time import sleep
 from random import shuffle
 from configparser import ConfigParser
@@ -18,9 +20,11 @@ from monero import (
     MoneroOutputQuery, MoneroTransfer, MoneroIncomingTransfer, MoneroOutgoingTransfer,
     MoneroTxWallet, MoneroOutputWallet, MoneroTx, MoneroAccount, MoneroSubaddress,
     MoneroMessageSignatureType, MoneroTxPriority, MoneroFeeEstimate,
-    MoneroIntegratedAddress, MoneroCheckTx, MoneroCheckReserve,
+    MoneroIntegratedAddress, MoneroCheck, MoneroCheckTx, MoneroCheckReserve, MoneroCheckBatchResult,
+    MoneroMessageBatchResult,
     MoneroAddressBookEntry, MoneroSubmitTxResult, MoneroAccountTag,
-    MoneroKeyImageExportResult
+    MoneroKeyImageExportResult,
+    VectorMoneroTxWallet, VectorMoneroTransfer, VectorMoneroOutputWallet # type: ignore
 )
 from utils import (
     MultisigSampleCodeTester,
@@ -248,6 +252,45 @@ class BaseTestMoneroWallet(BaseTestClass):
             if str(e) != "Invalid destination address":
                 raise
 
+    # Can create transactions for many configs without selecting the same inputs
+    @pytest.mark.skipif(TestUtils.TEST_RELAYS is False, reason="TEST_RELAYS disabled")
+    def test_create_txs_batch(self, wallet: MoneroWallet) -> None:
+        TestUtils.WALLET_TX_TRACKER.wait_for_txs_to_clear_pool(wallet)
+
+        # build configs with an invalid config in the middle
+        configs: list[MoneroTxConfig] = []
+        for i in range(3):
+            config = MoneroTxConfig()
+            config.account_index = 0
+            config.address = wallet.get_primary_address() if i != 1 else "my invalid address"
+            config.amount = TxWalletUtils.MAX_FEE * 5
+            config.relay = False
+            configs.append(config)
+
+        result = wallet.create_txs_batch(configs)
+        assert len(result.txs) == 3
+        assert len(result.errors) == 3
+        assert result.errors[0] is None
+        assert result.errors[1] == "Invalid destination address"
+        assert result.errors[2] is None
+        assert len(result.txs[0]) > 0
+        assert len(result.txs[1]) == 0
+        assert len(result.txs[2]) > 0
+
+        # configs do not share inputs
+        key_images: set[str] = set()
+        for txs in result.txs:
+            for tx in txs:
+                for tx_input in tx.inputs:
+                    assert tx_input.key_image is not None
+                    assert tx_input.key_image.hex is not None
+                    assert tx_input.key_image.hex not in key_images
+                    key_images.add(tx_input.key_image.hex)
+
+        # inputs are thawed after the batch
+        for key_image in key_images:
+            assert wallet.is_output_frozen(key_image) is False
+
     # Can sync with txs in the pool sent from/to the same account
     # TODO this test fails because wallet does not recognize pool tx sent from/to same account
     @pytest.mark.skipif(TestUtils.TEST_RELAYS is False, reason="TEST_RELAYS disabled")
@@ -1299,6 +1342,21 @@ class BaseTestMoneroWallet(BaseTestClass):
             WalletUtils.test_account(account, TestUtils.NETWORK_TYPE)
             assert len(account.subaddresses) > 0
 
+    # Can get all subaddress balances in one call
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_get_balances(self, wallet: MoneroWallet) -> None:
+        balances = wallet.get_balances()
+        accounts = wallet.get_accounts(True)
+        assert len(balances) == sum(len(account.subaddresses) for account in accounts)
+        for account in accounts:
+            for subaddress in account.subaddresses:
+                assert subaddress.account_index is not None
+                assert subaddress.index is not None
+                balance, unlocked_balance = balances[(subaddress.account_index, subaddress.index)]
+                assert balance == subaddress.balance
+                assert unlocked_balance == subaddress.unlocked_balance
+                assert unlocked_balance <= balance
+
     # Can get an account at a specified index
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     def test_get_account(self, wallet: MoneroWallet) -> None:
@@ -1456,6 +1514,31 @@ class BaseTestMoneroWallet(BaseTestClass):
 
             account_idx += 1
 
+    # Can create many subaddresses in one call
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_create_subaddresses(self, wallet: MoneroWallet) -> None:
+        # create subaddresses without labels
+        num_subaddresses = len(wallet.get_subaddresses(0))
+        subaddresses = wallet.create_subaddresses(0, 3)
+        assert len(subaddresses) == 3
+        for i, subaddress in enumerate(subaddresses):
+            WalletUtils.test_subaddress(subaddress)
+            assert subaddress.label is None
+            assert subaddress.index == num_subaddresses + i
+        assert len(wallet.get_subaddresses(0)) == num_subaddresses + 3
+
+        # create subaddresses with one label per subaddress
+        labels = [StringUtils.get_random_string() for _ in range(2)]
+        subaddresses = wallet.create_subaddresses(0, 2, labels)
+        assert [subaddress.label for subaddress in subaddresses] == labels
+
+        # cannot create subaddresses with mismatched labels
+        try:
+            wallet.create_subaddresses(0, 3, labels)
+            raise Exception("Should have failed")
+        except MoneroError as e:
+            assert str(e) == "Must provide no label, one label or one label per subaddress"
+
     # Can set subaddress labels
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     def test_set_subaddress_label(self, wallet: MoneroWallet) -> None:
@@ -2456,6 +2539,77 @@ class BaseTestMoneroWallet(BaseTestClass):
         for output in outputs:
             assert output.tx == tx
 
+    # Can serialize result vectors in bulk
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_serialize_many(self, wallet: MoneroWallet) -> None:
+        txs = wallet.get_txs()
+        transfers = wallet.get_transfers()
+        outputs = wallet.get_outputs()
+        assert len(txs) > 0, "Wallet has no txs; run send tests"
+
+        # bulk serialization matches per-object serialization, plus the block header of each tx and
+        # the type of each transfer
+        tx_jsons = loads(txs.serialize_many()) # type: ignore
+        for tx, tx_json in zip(txs, tx_jsons):
+            block_json = tx_json.pop("block", None)
+            assert tx_json == loads(tx.serialize())
+            assert (block_json is None) == (tx.block is None)
+            if block_json is not None:
+                assert block_json["height"] == tx.get_height()
+                assert "txs" not in block_json
+        transfer_jsons = loads(transfers.serialize_many()) # type: ignore
+        for transfer, transfer_json in zip(transfers, transfer_jsons):
+            assert transfer_json.pop("type") == ("incoming" if transfer.is_incoming() else "outgoing")
+            assert transfer_json == loads(transfer.serialize())
+        assert loads(outputs.serialize_many()) == [loads(output.serialize()) for output in outputs] # type: ignore
+
+        # bulk deserialization rebuilds equivalent objects with backlinks
+        data: bytes = txs.serialize_many() # type: ignore
+        restored_txs = VectorMoneroTxWallet.deserialize_many(data)
+        assert loads(restored_txs.serialize_many()) == loads(data)
+        for tx, restored_tx in zip(txs, restored_txs):
+            assert restored_tx.get_height() == tx.get_height()
+        for tx in restored_txs:
+            for transfer in tx.incoming_transfers:
+                assert transfer.tx is not None and transfer.tx.hash == tx.hash
+            if tx.outgoing_transfer is not None:
+                assert tx.outgoing_transfer.tx is not None and tx.outgoing_transfer.tx.hash == tx.hash
+            for output in tx.outputs:
+                assert output.tx is not None and output.tx.hash == tx.hash
+        data = transfers.serialize_many() # type: ignore
+        assert loads(VectorMoneroTransfer.deserialize_many(data).serialize_many()) == loads(data)
+        data = outputs.serialize_many() # type: ignore
+        assert loads(VectorMoneroOutputWallet.deserialize_many(data).serialize_many()) == loads(data)
+
+    # Can get outputs as columns
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_get_outputs_columns(self, wallet: MoneroWallet) -> None:
+        output_query: MoneroOutputQuery = MoneroOutputQuery()
+        output_query.account_index = 0
+        outputs: list[MoneroOutputWallet] = wallet.get_outputs(output_query)
+        columns = wallet.get_outputs_columns(output_query)
+        assert len(outputs) > 0, "Wallet has no outputs; run send tests"
+        assert len(columns) == len(outputs)
+
+        # columns are filled in output order
+        for i, output in enumerate(outputs):
+            assert columns.amounts[i] == output.amount
+            assert output.key_image is not None
+            assert columns.key_images[i] == output.key_image.hex
+            assert columns.account_indices[i] == 0
+            assert columns.subaddress_indices[i] == output.subaddress_index
+            assert columns.is_spent[i] == (1 if output.is_spent else 0)
+            assert columns.is_frozen[i] == (1 if output.is_frozen else 0)
+
+        # numeric columns expose their memory
+        amounts = memoryview(columns.amounts)
+        assert amounts.itemsize == 8
+        assert amounts.tolist() == list(columns.amounts)
+        assert memoryview(columns.is_spent).itemsize == 1
+
+        # default query returns every output
+        assert len(wallet.get_outputs_columns()) == len(wallet.get_outputs())
+
     # Can export outputs in hex format
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False or TestUtils.LITE_MODE, reason="TEST_NON_RELAYS disabled")
     def test_export_outputs(self, wallet: MoneroWallet) -> None:
@@ -2480,6 +2634,26 @@ class BaseTestMoneroWallet(BaseTestClass):
             num_imported: int = wallet.import_outputs(outputs_hex)
             assert num_imported >= 0
 
+    # Can export and import outputs in binary format
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False or TestUtils.LITE_MODE, reason="TEST_NON_RELAYS disabled")
+    def test_export_import_outputs_bytes(self, wallet: MoneroWallet) -> None:
+        # binary export is the decoded hex export
+        outputs_hex: str = wallet.export_outputs(True)
+        outputs: bytes = wallet.export_outputs_bytes(True)
+        assert outputs.hex() == outputs_hex
+
+        # stream export writes the same bytes in chunks
+        stream = BytesIO()
+        num_bytes: int = wallet.export_outputs_to(stream, True, 1024)
+        assert num_bytes == len(outputs)
+        assert stream.getvalue() == outputs
+
+        # import outputs in binary format and from stream
+        if len(outputs) > 0:
+            assert wallet.import_outputs_bytes(outputs) >= 0
+            stream.seek(0)
+            assert wallet.import_outputs_from(stream, 1024) >= 0
+
     # Has correct accounting across accounts, subaddresses, txs, transfers and outputs
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     def test_accounting(self, wallet: MoneroWallet) -> None:
@@ -2796,6 +2970,68 @@ class BaseTestMoneroWallet(BaseTestClass):
         result = wallet.check_spend_proof(tx.hash, "This is the right message", signature)
         assert result is False
 
+    # Can check many spend proofs and tx keys in one call
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_check_proofs_batch(self, wallet: MoneroWallet) -> None:
+        # get random confirmed outgoing txs
+        query: MoneroTxQuery = MoneroTxQuery()
+        query.is_incoming = False
+        query.in_tx_pool = False
+        query.is_failed = False
+        txs: list[MoneroTxWallet] = WalletTxsUtils.get_random_transactions(wallet, query, 2, WalletUtils.MAX_TX_PROOFS)
+
+        # build good spend proofs followed by a bad one
+        spend_checks: list[tuple[str, str, str]] = []
+        for tx in txs:
+            assert tx.hash is not None
+            spend_checks.append((tx.hash, "I am a message.", wallet.get_spend_proof(tx.hash, "I am a message.")))
+        spend_checks.append(("invalid_tx_id", "I am a message.", spend_checks[0][2]))
+        # unknown tx is reported as an error, not as a bad proof
+        spend_result: MoneroCheckBatchResult = wallet.check_spend_proofs(spend_checks, 2)
+        assert len(spend_result.checks) == len(spend_checks)
+        for i in range(len(txs)):
+            assert spend_result.errors[i] is None
+            spend_check: MoneroCheck | None = spend_result.checks[i]
+            assert spend_check is not None
+            assert spend_check.is_good is True
+        assert spend_result.checks[-1] is None
+        error: str | None = spend_result.errors[-1]
+        assert error is not None
+        WalletErrorUtils.test_invalid_tx_hash_error(Exception(error))
+
+        # signature which does not verify is a bad proof
+        assert txs[0].hash is not None
+        wrong_result: MoneroCheckBatchResult = wallet.check_spend_proofs([(txs[0].hash, "This is the wrong message", spend_checks[0][2])])
+        assert wrong_result.errors == [None]
+        wrong_check: MoneroCheck | None = wrong_result.checks[0]
+        assert wrong_check is not None
+        assert wrong_check.is_good is False
+
+        # batch results match single checks
+        key_checks: list[tuple[str, str, str]] = []
+        for tx in txs:
+            assert tx.hash is not None
+            assert tx.outgoing_transfer is not None
+            key: str = wallet.get_tx_key(tx.hash)
+            for destination in tx.outgoing_transfer.destinations:
+                assert destination.address is not None
+                key_checks.append((tx.hash, key, destination.address))
+        key_results: MoneroCheckBatchResult = wallet.check_tx_keys(key_checks, 2)
+        assert len(key_results.checks) == len(key_checks)
+        assert key_results.errors == [None] * len(key_checks)
+        for key_check, key_result in zip(key_checks, key_results.checks):
+            check: MoneroCheckTx = wallet.check_tx_key(*key_check)
+            assert isinstance(key_result, MoneroCheckTx)
+            assert key_result.is_good == check.is_good
+            assert key_result.received_amount == check.received_amount
+
+        # check which cannot be performed reports its error instead of raising
+        bad_results: MoneroCheckBatchResult = wallet.check_tx_keys([("invalid_tx_id", key_checks[0][1], key_checks[0][2])])
+        assert bad_results.checks == [None]
+        bad_error: str | None = bad_results.errors[0]
+        assert bad_error is not None
+        WalletErrorUtils.test_invalid_tx_hash_error(Exception(bad_error))
+
     # Can prove reserves in the wallet
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disablde")
     def test_get_reserve_proof_wallet(self, wallet: MoneroWallet) -> None:
@@ -3044,6 +3280,36 @@ class BaseTestMoneroWallet(BaseTestClass):
         GenUtils.test_unsigned_big_integer(result.spent_amount, has_spent)
         GenUtils.test_unsigned_big_integer(result.unspent_amount, has_unspent)
 
+    # Can import key images in chunks
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_import_key_images_chunked(self, wallet: MoneroWallet) -> None:
+        key_images = wallet.export_key_images(True).key_images
+        assert len(key_images) > 1, "Wallet does not have enough key images run send tests"
+        chunk_size = max(1, len(key_images) // 3)
+        result = wallet.import_key_images(key_images)
+
+        # import all key images in chunks from a generator
+        offsets: list[int] = []
+        chunked_result = wallet.import_key_images_chunked((key_image for key_image in key_images), chunk_size, 0, offsets.append)
+        assert offsets[-1] == len(key_images)
+        assert len(offsets) == (len(key_images) + chunk_size - 1) // chunk_size
+        assert chunked_result.height == result.height
+        assert chunked_result.spent_amount == result.spent_amount
+        assert chunked_result.unspent_amount == result.unspent_amount
+
+        # resume an import from the offset of its first chunk
+        offsets.clear()
+        resumed_result = wallet.import_key_images_chunked(key_images[chunk_size:], chunk_size, chunk_size, offsets.append)
+        assert offsets[-1] == len(key_images)
+        assert resumed_result.height == result.height
+
+        # chunk size must be positive
+        try:
+            wallet.import_key_images_chunked(key_images, 0)
+            raise Exception("Should have failed")
+        except ValueError:
+            pass
+
     # Supports view-only and offline wallets to create, sign and submit transactions
     @pytest.mark.skipif(TestUtils.LITE_MODE, reason="LITE_MODE enabled")
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False and TestUtils.TEST_RELAYS is False, reason="TEST_NON_RELAYS and TEST_RELAYS disabled")
@@ -3132,6 +3398,42 @@ class BaseTestMoneroWallet(BaseTestClass):
             result = wallet.verify_message(msg, WalletTestUtils.get_external_wallet_address(), signature)
             WalletUtils.test_message_signature_result(result, False)
 
+    # Can verify many message signatures in one call
+    @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_verify_messages(self, wallet: MoneroWallet) -> None:
+        msg: str = "This is a super important message which needs to be signed and verified."
+        address: str = wallet.get_address(0, 0)
+        signature: str = wallet.sign_message(msg, MoneroMessageSignatureType.SIGN_WITH_SPEND_KEY, 0, 0)
+
+        # repeat good signatures and mix in bad ones
+        messages: list[tuple[str, str, str]] = []
+        expected: list[bool] = []
+        for _ in range(10):
+            messages.append((msg, address, signature))
+            expected.append(True)
+        messages.append((msg, wallet.get_address(0, 2), signature))
+        expected.append(False)
+        messages.append((msg, WalletTestUtils.get_external_wallet_address(), signature))
+        expected.append(False)
+
+        batch_result: MoneroMessageBatchResult = wallet.verify_messages(messages, 4)
+        assert len(batch_result.results) == len(messages)
+        assert batch_result.errors == [None] * len(messages)
+        for result, is_good in zip(batch_result.results, expected):
+            WalletUtils.test_message_signature_result(result, is_good)
+            if is_good:
+                assert result is not None
+                assert result.signature_type == MoneroMessageSignatureType.SIGN_WITH_SPEND_KEY
+
+        # invalid address is reported as an error, not as a bad signature
+        batch_result = wallet.verify_messages([(msg, "invalid address", signature), (msg, address, signature)])
+        assert batch_result.results[0] is None
+        assert batch_result.errors[0] is not None
+        WalletUtils.test_message_signature_result(batch_result.results[1], True)
+
+        # empty batch
+        assert len(wallet.verify_messages([]).results) == 0
+
     # Has an address book
     @pytest.mark.skipif(TestUtils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     def test_address_book(self, wallet: MoneroWallet) -> None:
@@ -1,4 +1,5 @@
 import pytest
+import asyncio
 import logging
 
 from typing import Optional
@@ -9,14 +10,17 @@ from monero import (
     MoneroWalletFull, MoneroWalletConfig, MoneroAccount,
     MoneroSubaddress, MoneroWallet, MoneroNetworkType,
     MoneroRpcConnection, MoneroUtils, MoneroDaemonRpc,
-    MoneroSyncResult, MoneroTxWallet
+    MoneroSyncResult, MoneroTxWallet,
+    MoneroPartitionScanResult, MoneroBalanceIndex, MoneroSubaddressLookup, MoneroError
 )
 
 from utils import (
     TestUtils as Utils, StringUtils,
     AssertUtils, WalletUtils, WalletType,
     SyncSeedTester, SyncProgressTester,
-    WalletEqualityUtils, WalletErrorUtils
+    PartitionScanTester,
+    WalletEqualityUtils, WalletErrorUtils,
+    WalletTestUtils
 )
 from test_monero_wallet_common import BaseTestMoneroWallet
 
@@ -558,6 +562,184 @@ class TestMoneroWalletFull(BaseTestMoneroWallet):
         assert tester2.is_notified
         assert not tester3.is_notified
 
+    # Can sync and query the wallet from a running event loop
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_sync_async(self, wallet: MoneroWalletFull) -> None:
+        async def sync_and_get_txs() -> tuple[MoneroSyncResult, list[MoneroTxWallet]]:
+            result: MoneroSyncResult = await wallet.sync_async()
+            txs: list[MoneroTxWallet] = await wallet.get_txs_async()
+            return result, txs
+
+        result, txs = asyncio.run(sync_and_get_txs())
+        assert result.num_blocks_fetched >= 0
+        assert len(txs) == len(wallet.get_txs())
+
+    # Can cancel a sync started from a running event loop
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    @pytest.mark.skipif(Utils.LITE_MODE, reason="LITE_MODE enabled")
+    def test_sync_async_cancel(self) -> None:
+        config: MoneroWalletConfig = MoneroWalletConfig()
+        config.seed = Utils.SEED
+        config.restore_height = 0
+        wallet: MoneroWalletFull = self._create_wallet(config, False)
+
+        async def sync_and_cancel() -> None:
+            future = wallet.sync_async()
+            await asyncio.sleep(0.1)
+            # sync may already be done on a short chain
+            cancelled: bool = future.cancel()
+            try:
+                await future
+                assert not cancelled
+            except asyncio.CancelledError:
+                assert cancelled
+
+        try:
+            asyncio.run(sync_and_cancel())
+            # wallet can sync again after cancellation
+            wallet.sync()
+            assert wallet.get_height() == wallet.get_daemon_height()
+        finally:
+            wallet.close()
+
+    # Cancelling one sync does not stop another sync of the same wallet
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    @pytest.mark.skipif(Utils.LITE_MODE, reason="LITE_MODE enabled")
+    def test_sync_async_cancel_isolated(self) -> None:
+        config: MoneroWalletConfig = MoneroWalletConfig()
+        config.seed = Utils.SEED
+        config.restore_height = 0
+        wallet: MoneroWalletFull = self._create_wallet(config, False)
+
+        async def sync_and_cancel_other() -> None:
+            future = wallet.sync_async()
+            other = wallet.sync_async()
+            other.cancel()
+            await future
+            with pytest.raises(asyncio.CancelledError):
+                await other
+
+        try:
+            asyncio.run(sync_and_cancel_other())
+            assert wallet.get_height() == wallet.get_daemon_height()
+        finally:
+            wallet.close()
+
+    # Can scan the blockchain in concurrent partitions
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    @pytest.mark.skipif(Utils.LITE_MODE, reason="LITE_MODE enabled")
+    def test_scan_partitioned(self, daemon: MoneroDaemonRpc, wallet: MoneroWalletFull) -> None:
+        # scan recent blocks in partitions
+        end_height: int = daemon.get_height()
+        start_height: int = max(wallet.get_restore_height(), end_height - 200)
+        listener: PartitionScanTester = PartitionScanTester()
+        result: MoneroPartitionScanResult = wallet.scan_partitioned(start_height, end_height, 4, listener)
+        assert result.start_height == start_height
+        assert result.end_height == end_height
+        assert 0 < result.num_partitions <= 4
+        assert listener.is_notified
+
+        # found txs are in height order and within the scanned range
+        prev_height: int = start_height
+        for tx in result.txs:
+            height = tx.get_height()
+            assert height is not None
+            assert start_height <= height < end_height
+            assert height >= prev_height
+            prev_height = height
+
+        # compare with wallet's confirmed txs in the range
+        tx_hashes: set[str] = set()
+        for tx in wallet.get_txs():
+            height = tx.get_height()
+            if tx.is_incoming and height is not None and start_height <= height < end_height:
+                assert tx.hash is not None
+                tx_hashes.add(tx.hash)
+        found_hashes: set[str] = set(tx.hash for tx in result.txs if tx.hash is not None)
+        assert tx_hashes.issubset(found_hashes)
+
+    # Can get the wallet files as binary buffers and open a wallet from them
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_wallet_data_buffers(self, wallet: MoneroWalletFull) -> None:
+        keys_data: bytes = wallet.get_keys_file_buffer(Utils.WALLET_PASSWORD, False)
+        cache_data: bytes = wallet.get_cache_file_buffer()
+        assert isinstance(keys_data, bytes)
+        assert isinstance(cache_data, bytes)
+        assert len(keys_data) > 0
+        assert len(cache_data) > 0
+
+        # open from buffer-protocol objects other than bytes
+        opened: MoneroWalletFull = MoneroWalletFull.open_wallet_data(
+            Utils.WALLET_PASSWORD, Utils.NETWORK_TYPE, memoryview(keys_data), bytearray(cache_data)
+        )
+        try:
+            assert opened.get_primary_address() == wallet.get_primary_address()
+            assert opened.get_seed() == wallet.get_seed()
+            assert opened.get_height() == wallet.get_height()
+        finally:
+            opened.close()
+
+    # Can save the wallet in the background
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_save_async(self) -> None:
+        wallet: MoneroWalletFull = self._create_wallet(None, False)
+        path: str = wallet.get_path()
+        wallet.set_attribute("key", "value")
+
+        async def save_and_read() -> str:
+            # wallet can be read while saving
+            future = wallet.save_async()
+            address: str = wallet.get_primary_address()
+            # blocking save waits for the background save of the same wallet
+            wallet.save()
+            await future
+            return address
+
+        try:
+            assert asyncio.run(save_and_read()) == wallet.get_primary_address()
+        finally:
+            wallet.close()
+
+        # saved state is reloaded
+        config: MoneroWalletConfig = MoneroWalletConfig()
+        config.path = path
+        wallet = self._open_wallet(config, False)
+        try:
+            assert wallet.get_attribute("key") == "value"
+        finally:
+            wallet.close()
+
+    # Can read subaddress balances from a balance index
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_balance_index(self, wallet: MoneroWalletFull) -> None:
+        index: MoneroBalanceIndex = MoneroBalanceIndex(wallet)
+        try:
+            balances = wallet.get_balances()
+            assert index.get_balances() == balances
+            for (account_idx, subaddress_idx), (balance, unlocked_balance) in balances.items():
+                assert index.get_balance(account_idx, subaddress_idx) == balance
+                assert index.get_unlocked_balance(account_idx, subaddress_idx) == unlocked_balance
+
+            # unknown subaddress has no balance
+            assert index.get_balance(len(wallet.get_accounts()), 0) == 0
+
+            # table follows the wallet across a sync
+            wallet.sync()
+            assert index.get_balances() == wallet.get_balances()
+
+            # table is rebuilt on demand
+            index.invalidate()
+            assert index.get_balances() == wallet.get_balances()
+        finally:
+            index.close()
+
+        # cannot read closed index
+        try:
+            index.get_balances()
+            raise Exception("Should have failed")
+        except MoneroError as e:
+            assert str(e) == "Balance index is closed"
+
     # Can create a subaddress with and without a label
     @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     @override
@@ -591,6 +773,51 @@ class TestMoneroWalletFull(BaseTestMoneroWallet):
             AssertUtils.assert_equals(subaddress, subaddresses_new[len(subaddresses_new) - 1])
             account_idx += 1
 
+    # Can resolve subaddress indices from a local lookup table
+    @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
+    def test_subaddress_lookup(self, wallet: MoneroWalletFull) -> None:
+        lookup: MoneroSubaddressLookup = MoneroSubaddressLookup(wallet)
+        num_subaddresses: int = sum(len(wallet.get_subaddresses(account.index)) for account in wallet.get_accounts() if account.index is not None)
+        assert len(lookup) == num_subaddresses
+        assert len(lookup) * 4 <= lookup.get_capacity() * 3
+
+        # lookup matches the wallet
+        for subaddress in wallet.get_subaddresses(0):
+            assert subaddress.address is not None
+            assert subaddress.address in lookup
+            retrieved: MoneroSubaddress = lookup.get_address_index(subaddress.address)
+            assert retrieved.account_index == subaddress.account_index
+            assert retrieved.index == subaddress.index
+
+        # subaddresses created through the table are indexed
+        created: list[MoneroSubaddress] = lookup.create_subaddresses(0, 2)
+        assert len(lookup) == num_subaddresses + 2
+        for subaddress in created:
+            assert subaddress.address is not None
+            assert lookup.get_address_index(subaddress.address).index == subaddress.index
+
+        # subaddresses created outside of the table are picked up on refresh
+        subaddress = wallet.create_subaddress(0)
+        assert subaddress.address is not None
+        assert subaddress.address not in lookup
+        lookup.refresh()
+        assert lookup.get_address_index(subaddress.address).index == subaddress.index
+
+        # cannot resolve address which is not in the table
+        try:
+            lookup.get_address_index(WalletTestUtils.get_external_wallet_address())
+            raise Exception("Should have failed")
+        except MoneroError as e:
+            assert str(e) == "Address doesn't belong to the wallet"
+
+        # cannot resolve invalid address
+        assert "invalid address" not in lookup
+        try:
+            lookup.get_address_index("invalid address")
+            raise Exception("Should have failed")
+        except MoneroError as e:
+            WalletErrorUtils.test_invalid_address_error(e)
+
     # Can be closed
     @pytest.mark.skipif(Utils.TEST_NON_RELAYS is False, reason="TEST_NON_RELAYS disabled")
     def test_close(self) -> None:
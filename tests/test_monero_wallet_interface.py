@@ -349,6 +349,10 @@ class TestMoneroWalletInterface(BaseTestClass):
     def test_sign_txs(self, wallet: MoneroWallet) -> None:
         wallet.sign_txs("")
 
+    @pytest.mark.not_supported
+    def test_sign_txs_batch(self, wallet: MoneroWallet) -> None:
+        wallet.sign_txs_batch([""])
+
     @pytest.mark.not_supported
     def test_submit_txs(self, wallet: MoneroWallet) -> None:
         wallet.submit_txs("")
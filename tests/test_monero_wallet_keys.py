@@ -238,6 +238,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_get_all_balances(self, wallet: MoneroWallet) -> None:
         return super().test_get_all_balances(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_get_balances(self, wallet: MoneroWallet) -> None:
+        return super().test_get_balances(wallet)
+
     @pytest.mark.not_supported
     @override
     def test_create_account_without_label(self, wallet: MoneroWallet) -> None:
@@ -263,6 +268,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_create_subaddress(self, wallet: MoneroWallet) -> None:
         return super().test_create_subaddress(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_create_subaddresses(self, wallet: MoneroWallet) -> None:
+        return super().test_create_subaddresses(wallet)
+
     @pytest.mark.xfail(raises=RuntimeError, reason="Keys-only wallet does not have enumerable set of subaddresses")
     @override
     def test_set_subaddress_label(self, wallet: MoneroWallet) -> None:
@@ -293,6 +303,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_import_key_images(self, wallet: MoneroWallet) -> None:
         return super().test_import_key_images(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_import_key_images_chunked(self, wallet: MoneroWallet) -> None:
+        return super().test_import_key_images_chunked(wallet)
+
     @pytest.mark.not_supported
     @override
     def test_set_attributes(self, wallet: MoneroWallet) -> None:
@@ -323,6 +338,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_validate_inputs_sending_funds(self, wallet: MoneroWallet) -> None:
         return super().test_validate_inputs_sending_funds(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_create_txs_batch(self, wallet: MoneroWallet) -> None:
+        return super().test_create_txs_batch(wallet)
+
     @pytest.mark.not_supported
     @override
     def test_export_outputs(self, wallet: MoneroWallet) -> None:
@@ -333,6 +353,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_import_outputs(self, wallet: MoneroWallet) -> None:
         return super().test_import_outputs(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_export_import_outputs_bytes(self, wallet: MoneroWallet) -> None:
+        return super().test_export_import_outputs_bytes(wallet)
+
     @pytest.mark.not_supported
     @override
     def test_send_to_self(self, wallet: MoneroWallet) -> None:
@@ -358,6 +383,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_sign_and_verify_messages(self, wallet: MoneroWallet) -> None:
         return super().test_sign_and_verify_messages(wallet)
 
+    @pytest.mark.not_implemented
+    @override
+    def test_verify_messages(self, wallet: MoneroWallet) -> None:
+        return super().test_verify_messages(wallet)
+
     @pytest.mark.not_supported
     @override
     def test_freeze_outputs(self, wallet: MoneroWallet) -> None:
@@ -368,6 +398,16 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_get_outputs_with_query(self, wallet: MoneroWallet) -> None:
         return super().test_get_outputs_with_query(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_get_outputs_columns(self, wallet: MoneroWallet) -> None:
+        return super().test_get_outputs_columns(wallet)
+
+    @pytest.mark.not_supported
+    @override
+    def test_serialize_many(self, wallet: MoneroWallet) -> None:
+        return super().test_serialize_many(wallet)
+
     @pytest.mark.xfail(raises=RuntimeError, reason="Keys-only wallet does not have enumerable set of subaddresses")
     @override
     def test_input_key_images(self, wallet: MoneroWallet) -> None:
@@ -448,6 +488,11 @@ class TestMoneroWalletKeys(BaseTestMoneroWallet):
     def test_check_spend_proof(self, wallet: MoneroWallet) -> None:
         return super().test_check_spend_proof(wallet)
 
+    @pytest.mark.not_supported
+    @override
+    def test_check_proofs_batch(self, wallet: MoneroWallet) -> None:
+        return super().test_check_proofs_batch(wallet)
+
     @pytest.mark.not_supported
     @override
     def test_get_reserve_proof_wallet(self, wallet: MoneroWallet) -> None:
@@ -41,6 +41,7 @@ from .submit_then_relay_tx_tester import SubmitThenRelayTxTester
 from .multisig_sample_code_tester import MultisigSampleCodeTester
 from .wallet_sync_tester import WalletSyncTester
 from .sync_progress_tester import SyncProgressTester
+from .partition_scan_tester import PartitionScanTester
 from .sync_seed_tester import SyncSeedTester
 from .send_and_update_txs_tester import SendAndUpdateTxsTester
 from .sync_with_pool_submit_tester import SyncWithPoolSubmitTester
@@ -90,6 +91,7 @@ __all__ = [
     'MultisigSampleCodeTester',
     'WalletSyncTester',
     'SyncProgressTester',
+    'PartitionScanTester',
     'SyncSeedTester',
     'SendAndUpdateTxsTester',
     'SyncWithPoolSubmitTester',
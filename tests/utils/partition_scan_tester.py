@@ -0,0 +1,41 @@
+import logging
+
+from threading import Lock
+from typing_extensions import override
+from monero import MoneroPartitionScanListener
+
+logger: logging.Logger = logging.getLogger("PartitionScanTester")
+
+
+class PartitionScanTester(MoneroPartitionScanListener):
+    """Partition scan progress tester."""
+
+    _lock: Lock
+    """Lock guarding notifications from partition threads."""
+    partition_heights: dict[int, int]
+    """Last height notified by each partition."""
+
+    @property
+    def is_notified(self) -> bool:
+        """Check if listener was notified.
+
+        :returns bool: `True` if listener got notified by partition progress.
+        """
+        return len(self.partition_heights) > 0
+
+    def __init__(self) -> None:
+        """Initialize a new partition scan tester."""
+        super().__init__()
+        self._lock = Lock()
+        self.partition_heights = {}
+
+    @override
+    def on_partition_progress(self, partition_idx: int, height: int, start_height: int, end_height: int, blocks_per_second: float) -> None:
+        logger.info(f"on_partition_progress({partition_idx}, {height}, {start_height}, {end_height}, {blocks_per_second})")
+        assert start_height <= height
+        assert blocks_per_second >= 0
+        with self._lock:
+            # heights are monotonic within a partition
+            prev_height = self.partition_heights.get(partition_idx)
+            assert prev_height is None or prev_height <= height
+            self.partition_heights[partition_idx] = height
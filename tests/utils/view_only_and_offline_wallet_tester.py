@@ -1,7 +1,8 @@
 from monero import (
     MoneroWallet, MoneroTxWallet, MoneroTransfer,
     MoneroOutputWallet, MoneroWalletRpc, MoneroTxQuery,
-    MoneroKeyImageExportResult, MoneroTxConfig, MoneroTxSet
+    MoneroKeyImageExportResult, MoneroTxConfig, MoneroTxSet,
+    MoneroTxSetBatchResult
 )
 from .test_utils import TestUtils
 from .tx_wallet_utils import TxWalletUtils
@@ -146,6 +147,19 @@ class ViewOnlyAndOfflineWalletTester:
         assert tx_from_set.hash is not None
         assert len(tx_from_set.hash) > 0
 
+        # sign copies of the unsigned tx set in one batch using offline wallet
+        # an invalid set does not fail the others
+        batch_result: MoneroTxSetBatchResult = self._offline_wallet.sign_txs_batch([unsigned_tx.tx_set.unsigned_tx_hex] * 3 + ["invalid"])
+        assert len(batch_result.tx_sets) == 4
+        assert len(batch_result.errors) == 4
+        for i in range(3):
+            assert batch_result.errors[i] is None
+            batch_tx_set: MoneroTxSet = batch_result.tx_sets[i]
+            assert batch_tx_set.signed_tx_hex is not None
+            assert len(batch_tx_set.signed_tx_hex) > 0
+            assert len(batch_tx_set.txs) == 1
+        assert batch_result.errors[3] is not None
+
         # parse or "describe" unsigned tx set
         described_tx_set: MoneroTxSet = self._offline_wallet.describe_unsigned_tx_set(unsigned_tx.tx_set.unsigned_tx_hex)
         TxWalletUtils.test_described_tx_set(described_tx_set, TestUtils.NETWORK_TYPE)